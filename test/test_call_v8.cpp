@@ -1,8 +1,19 @@
 #include "v8pp/call_v8.hpp"
+#include "v8pp/class.hpp"
 #include "v8pp/context.hpp"
+#include "v8pp/object.hpp"
 
 #include "test.hpp"
 
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+struct Tick
+{
+	int frame;
+};
+
 static void v8_arg_count(v8::FunctionCallbackInfo<v8::Value> const& args)
 {
 	args.GetReturnValue().Set(args.Length());
@@ -30,4 +41,91 @@ void test_call_v8()
 	check("empty result",
 		v8pp::call_v8(isolate, fun, fun).IsEmpty());
 	check("has caught", try_catch.HasCaught());
+
+	{
+		v8::TryCatch try_catch(isolate);
+
+		v8pp::class_<Tick> Tick_class(isolate);
+		Tick_class.var("frame", &Tick::frame);
+
+		Tick tick{ 42 };
+		fun = context.run_script("var saved; (function(tick) { saved = tick; return tick.frame; })").As<v8::Function>();
+		check_eq("borrowed object",
+			v8pp::call_v8(isolate, fun, fun, v8pp::borrowed(isolate, tick))->Int32Value(isolate->GetCurrentContext()).FromJust(), 42);
+		check_eq("borrowed object again",
+			v8pp::call_v8(isolate, fun, fun, v8pp::borrowed(isolate, tick))->Int32Value(isolate->GetCurrentContext()).FromJust(), 42);
+		check("escaped borrowed object unwraps to null",
+			v8pp::class_<Tick>::unwrap_object(isolate, context.run_script("saved")) == nullptr);
+		check("escaped borrowed object access", context.run_script("saved.frame").IsEmpty());
+		check("escaped borrowed object access has caught", try_catch.HasCaught());
+	}
+
+	{
+		fun = context.run_script("(function(a, b) { if (b == 0) throw new Error('division by zero'); return a / b; })").As<v8::Function>();
+
+		v8pp::prepared_call<int(int, int)> divide(isolate, fun);
+		auto result = divide(6, 3);
+		check("prepared call", result.has_value());
+		check_eq("prepared call result", *result, 2);
+
+		result = divide(1, 0);
+		check("prepared call exception", !result);
+		check_eq("prepared call error", result.error(), "Error: division by zero");
+		check_eq("prepared call value_or", result.value_or(-1), -1);
+		check_ex<std::runtime_error>("prepared call value", [&result]() { result.value(); });
+
+		v8pp::prepared_call<std::vector<int>(int, int)> wrong_result(isolate, fun);
+		check("prepared call conversion error", !wrong_result(6, 3));
+
+		std::vector<std::tuple<int, int>> const batch = { { 6, 3 }, { 1, 0 }, { 8, 2 } };
+		std::vector<v8pp::call_result<int>> results;
+		divide.call_each(batch, std::back_inserter(results));
+		check_eq("prepared call batch size", results.size(), 3u);
+		check_eq("prepared call batch 0", results[0].value_or(0), 2);
+		check("prepared call batch 1", !results[1]);
+		check_eq("prepared call batch 2", results[2].value_or(0), 4);
+
+		fun = context.run_script("(function(x) { this.sum = (this.sum || 0) + x; })").As<v8::Function>();
+		v8::Local<v8::Object> recv = v8::Object::New(isolate);
+		v8pp::prepared_call<void(double)> accumulate(isolate, fun, recv);
+		check("prepared void call", accumulate(1.5).has_value());
+
+		std::vector<double> const values = { 2, 3 };
+		std::vector<v8pp::call_result<void>> void_results;
+		accumulate.call_each(values, std::back_inserter(void_results));
+		check_eq("prepared void call batch size", void_results.size(), 2u);
+		double sum = 0;
+		check("prepared call receiver", v8pp::get_option(isolate, recv, "sum", sum));
+		check_eq("prepared call receiver sum", sum, 6.5);
+	}
+
+	{
+		v8::TryCatch try_catch(isolate);
+
+		v8::Local<v8::Object> handler = context.run_script("({ ticks: 0, onTick(n) { return this.ticks += n; } })").As<v8::Object>();
+		check_eq("call_method",
+			v8pp::call_method(isolate, handler, "onTick", 2)->Int32Value(isolate->GetCurrentContext()).FromJust(), 2);
+		check_eq("call_method in context",
+			v8pp::call_method(isolate, isolate->GetCurrentContext(), handler, "onTick", 3)->Int32Value(isolate->GetCurrentContext()).FromJust(), 5);
+		check("call_method not a function", v8pp::call_method(isolate, handler, "ticks").IsEmpty());
+		check("call_method not a function has caught", try_catch.HasCaught());
+		try_catch.Reset();
+
+		v8pp::bound_method on_tick(isolate, handler, "onTick");
+		check("bound_method", on_tick.is_valid());
+		check_eq("bound_method call", on_tick(1)->Int32Value(isolate->GetCurrentContext()).FromJust(), 6);
+		check("bound_method refresh unchanged", !on_tick.refresh());
+
+		context.run_script("var replaced = function(n) { return -n; }");
+		v8::Local<v8::Value> replaced = context.run_script("replaced");
+		handler->Set(isolate->GetCurrentContext(), v8pp::to_v8(isolate, "onTick"), replaced).FromJust();
+		check_eq("bound_method cached call", on_tick(1)->Int32Value(isolate->GetCurrentContext()).FromJust(), 7);
+		check("bound_method refresh changed", on_tick.refresh());
+		check_eq("bound_method refreshed call", on_tick(1)->Int32Value(isolate->GetCurrentContext()).FromJust(), -1);
+
+		v8pp::bound_method missing(isolate, handler, "onMissing");
+		check("bound_method missing", !missing);
+		check("bound_method missing call", missing().IsEmpty());
+		check("bound_method missing has caught", try_catch.HasCaught());
+	}
 }
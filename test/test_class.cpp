@@ -6,6 +6,9 @@
 
 #include "test.hpp"
 
+#include <atomic>
+#include <numeric>
+#include <thread>
 #include <type_traits>
 
 struct Xbase
@@ -329,6 +332,12 @@ void test_class_()
 	check_eq("Y count after GC", Y::instance_count,
 		1 + 2 * use_shared_ptr); // y1 + (y2 + y3 when use_shared_ptr)
 
+	v8pp::sweep_stats const sweep_stats = v8pp::class_<Y, Traits>::sweep_stats(isolate);
+	check("Y sweeps after GC", sweep_stats.sweeps > 0);
+	check("Y swept objects after GC", sweep_stats.objects >= 10);
+	check("Y max swept objects", sweep_stats.max_objects > 0 && sweep_stats.max_objects <= sweep_stats.objects);
+	check("Y max sweep duration", sweep_stats.max_duration <= sweep_stats.duration);
+
 	y1_obj = v8pp::class_<Y, Traits>::reference_external(context.isolate(), y1);
 
 	check_eq("Y count before class_<Y>::destroy", Y::instance_count,
@@ -366,7 +375,8 @@ void test_multiple_inheritance()
 	struct C : A, B
 	{
 		int x;
-		C() : x(3) {}
+		long double w;
+		C() : x(3), w(0.25) {}
 		int h() { return x; }
 		void set_h(int v) { x = v; }
 
@@ -380,6 +390,7 @@ void test_multiple_inheritance()
 	v8pp::class_<B, Traits> B_class(isolate);
 	B_class
 		.var("xB", &B::x)
+		.template var<&B::x>("fxB")
 		.function("zB", &B::z)
 		.function("g", &B::g);
 
@@ -389,6 +400,9 @@ void test_multiple_inheritance()
 		.template ctor<>()
 		.var("xA", &A::x)
 		.var("xC", &C::x)
+		.template var<&A::x>("fxA")
+		.template var<&C::x>("fxC")
+		.template var<&C::w>("fwC")
 
 		.function("zA", &A::z)
 		.function("zC", &C::z)
@@ -410,6 +424,30 @@ void test_multiple_inheritance()
 	check_eq("set attributes", run_script<int>(context,
 		"c = new C(); c.xA = 10; c.xB = 20; c.xC = 30; c.xA + c.xB + c.xC"), 10 + 20 + 30);
 
+	check_eq("get direct attributes", run_script<int>(context, "c = new C(); c.fxA + c.fxB + c.fxC"), 1 + 2 + 3);
+	check_eq("set direct attributes", run_script<int>(context,
+		"c = new C(); c.fxA = 10; c.fxB = 20; c.fxC = 30; c.xA + c.xB + c.xC"), 10 + 20 + 30);
+	check_eq("set direct attribute invalid value", run_script<int>(context,
+		"c = new C(); try { c.fxC = 'abc'; } catch (e) {} c.fxC"), 3);
+	check_ex<std::runtime_error>("set direct attribute invalid value in strict mode", [&context]()
+	{
+		run_script<int>(context, "'use strict'; c = new C(); c.fxC = 'abc'; c.fxC");
+	});
+	check_ex<std::runtime_error>("get direct attribute of invalid instance", [&context]()
+	{
+		run_script<int>(context, "Reflect.get(new C(), 'fxC', {})");
+	});
+	check_eq("direct long double attribute", run_script<double>(context, "c = new C(); c.fwC = c.fwC * 2; c.fwC"), 0.5);
+	check("direct attributes on prototype", run_script<bool>(context,
+		"!Object.hasOwn(c, 'fxC') && Object.hasOwn(Object.getPrototypeOf(c), 'fxC')"));
+
+	auto c = v8pp::class_<C, Traits>::unwrap_object(isolate, context.run_script("c"));
+	v8pp::class_<C, Traits>::destroy_object(isolate, c);
+	check_ex<std::runtime_error>("get direct attribute of destroyed instance", [&context]()
+	{
+		run_script<int>(context, "c.fxC");
+	});
+
 	check_eq("functions", run_script<int>(context, "c = new C(); c.f() + c.g() + c.h()"), 1 + 2 + 3);
 	check_eq("z functions", run_script<int>(context, "c = new C(); c.zA() + c.zB() + c.zC()"), 1 + 2 + 3);
 
@@ -477,6 +515,596 @@ void test_auto_wrap_objects()
 	check_eq("return X object", run_script<int>(context, "obj = f(123); obj.x"), 123);
 }
 
+struct U
+{
+	static int instance_count;
+
+	int x;
+	explicit U(int x) : x(x) { ++instance_count; }
+	~U() { --instance_count; }
+};
+
+int U::instance_count = 0;
+
+struct I
+{
+	static int instance_count;
+
+	int refs = 0;
+	int x;
+	explicit I(int x) : x(x) { ++instance_count; }
+	~I() { --instance_count; }
+
+	friend void intrusive_ptr_add_ref(I* i) { ++i->refs; }
+	friend void intrusive_ptr_release(I* i) { if (--i->refs == 0) delete i; }
+};
+
+int I::instance_count = 0;
+
+void test_unique_ptr()
+{
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	U::instance_count = 0;
+
+	v8pp::unique_class<U> U_class(isolate);
+	U_class
+		.ctor<int>()
+		.var("x", &U::x)
+		;
+
+	std::unique_ptr<U> stored;
+	auto make = [](int x) { return std::make_unique<U>(x); };
+	auto take = [&stored](std::unique_ptr<U> u) { stored = std::move(u); };
+	auto get = [](U const& u) { return u.x; };
+
+	context
+		.class_("U", U_class)
+		.function<decltype(make), v8pp::unique_ptr_traits>("make", std::move(make))
+		.function<decltype(take), v8pp::unique_ptr_traits>("take", std::move(take))
+		.function<decltype(get), v8pp::unique_ptr_traits>("get", std::move(get))
+		;
+
+	check_eq("unique_ptr to JS", run_script<int>(context, "u = make(10); u.x"), 10);
+	check_eq("unique_ptr instances", U::instance_count, 1);
+
+	check_eq("unique_ptr from JS", run_script<int>(context, "take(u); get(new U(1))"), 1);
+	check("unique_ptr moved out", stored && stored->x == 10);
+	check_ex<std::runtime_error>("moved out wrapper", [&context]()
+	{
+		run_script<int>(context, "get(u)");
+	});
+
+	{
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Object> obj = v8pp::to_v8(isolate, std::move(stored));
+		check("unique_ptr moved in", !stored);
+		check_eq("unique_ptr moved in x", U_class.unwrap_object(isolate, obj)->x, 10);
+	}
+
+	U u(1);
+	v8::Local<v8::Object> u_obj = U_class.reference_external(isolate, &u);
+	check_ex<std::runtime_error>("release referenced object", [isolate, u_obj]()
+	{
+		v8pp::from_v8<std::unique_ptr<U>>(isolate, u_obj);
+	});
+	U_class.unreference_external(isolate, &u);
+
+	run_script<int>(context, "u = null; for (i = 0; i < 10; ++i) { new U(i); } 0");
+	isolate->RequestGarbageCollectionForTesting(
+		v8::Isolate::GarbageCollectionType::kFullGarbageCollection);
+	check_eq("unique_ptr instances after GC", U::instance_count, 1); // u
+}
+
+void test_intrusive_ptr()
+{
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	I::instance_count = 0;
+
+	v8pp::intrusive_class<I> I_class(isolate);
+	I_class
+		.ctor<int>()
+		.var("x", &I::x)
+		.property("refs", [](I const& i) { return i.refs; })
+		;
+
+	I* shared = new I(42);
+	intrusive_ptr_add_ref(shared);
+
+	auto get_shared = [shared]() { return shared; };
+	auto use = [](I* i) { return i->x; };
+
+	context
+		.class_("I", I_class)
+		.function<decltype(get_shared), v8pp::intrusive_ptr_traits>("shared", std::move(get_shared))
+		.function<decltype(use), v8pp::intrusive_ptr_traits>("use", std::move(use))
+		;
+
+	check_eq("intrusive object created", run_script<int>(context, "i = new I(1); i.refs"), 1);
+	check_eq("intrusive object adopted", run_script<int>(context, "s = shared(); s.refs"), 2);
+	check_eq("intrusive object found", run_script<bool>(context, "shared() === s"), true);
+	check_eq("intrusive object arg", run_script<int>(context, "use(s) + use(i)"), 43);
+
+	run_script<int>(context, "i = null; s = null; 0");
+	isolate->RequestGarbageCollectionForTesting(
+		v8::Isolate::GarbageCollectionType::kFullGarbageCollection);
+	check_eq("intrusive refs after GC", shared->refs, 1);
+	check_eq("intrusive instances after GC", I::instance_count, 1);
+
+	intrusive_ptr_release(shared);
+	check_eq("intrusive instances after release", I::instance_count, 0);
+}
+
+struct D
+{
+	static std::atomic<int> instance_count;
+	static std::thread::id destroy_thread;
+
+	D() { ++instance_count; }
+	~D() { --instance_count; destroy_thread = std::this_thread::get_id(); }
+};
+
+std::atomic<int> D::instance_count = 0;
+std::thread::id D::destroy_thread;
+
+void test_destroy_in_background()
+{
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	D::instance_count = 0;
+	D::destroy_thread = std::this_thread::get_id();
+
+	v8pp::class_<D> D_class(isolate);
+	D_class
+		.ctor<>()
+		.destroy_in_background()
+		;
+
+	context.class_("D", D_class);
+	run_script<int>(context, "for (i = 0; i < 10; ++i) { new D(); } 0");
+	isolate->RequestGarbageCollectionForTesting(
+		v8::Isolate::GarbageCollectionType::kFullGarbageCollection);
+
+	v8pp::detail::destroy_queue::instance().wait();
+	check_eq("D count after GC", D::instance_count.load(), 0);
+	check("D destroyed in background", D::destroy_thread != std::this_thread::get_id());
+
+	v8pp::class_<D>::create_object(isolate);
+	check_eq("D count", D::instance_count.load(), 1);
+	v8pp::class_<D>::destroy(isolate);
+	check_eq("D count after class_<D>::destroy", D::instance_count.load(), 0);
+
+	// background destroy turned off after posting, destroy waits for posted tasks
+	v8pp::class_<D> D_class2(isolate);
+	D_class2
+		.ctor<>()
+		.destroy_in_background()
+		;
+	context.class_("D", D_class2);
+	run_script<int>(context, "for (i = 0; i < 10; ++i) { new D(); } 0");
+	isolate->RequestGarbageCollectionForTesting(
+		v8::Isolate::GarbageCollectionType::kFullGarbageCollection);
+	D_class2.destroy_in_background(false);
+	v8pp::class_<D>::destroy(isolate);
+	check_eq("D count after turned off background destroy", D::instance_count.load(), 0);
+
+	// waiting for own tasks doesn't wait for tasks of other posters
+	auto& queue = v8pp::detail::destroy_queue::instance();
+	v8pp::detail::destroy_queue::pending_tasks other, own;
+	std::atomic<bool> release = false;
+	queue.post([&release]() { while (!release) std::this_thread::yield(); }, other);
+	queue.wait(own);
+	release = true;
+	queue.wait(other);
+	check_eq("other tasks done", other.count, 0u);
+}
+
+struct Point
+{
+	static int instance_count;
+
+	int x, y;
+	Point(int x, int y) : x(x), y(y) { ++instance_count; }
+	Point(Point const& other) : x(other.x), y(other.y) { ++instance_count; }
+	~Point() { --instance_count; }
+};
+
+int Point::instance_count = 0;
+
+template<typename Traits>
+void test_identity_tracking()
+{
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	Point::instance_count = 0;
+
+	v8pp::class_<Point, Traits> Point_class(isolate);
+	Point_class
+		.identity_tracking(false)
+		.template ctor<int, int>()
+		.var("x", &Point::x)
+		.var("y", &Point::y)
+		;
+
+	Point const origin(1, 2);
+	auto f = [&origin]() -> Point const& { return origin; };
+
+	context.class_("Point", Point_class);
+	context.function<decltype(f), Traits>("origin", std::move(f));
+
+	check_eq("Point ctor", run_script<int>(context, "v = new Point(3, 4); v.x + v.y"), 7);
+	check_eq("Point copies", run_script<int>(context, "a = origin(); b = origin(); a.x = 5; a.x + b.x"), 6);
+	check("Point fresh wrappers", run_script<bool>(context, "a !== b"));
+	check_eq("Point instances", Point::instance_count, 4);
+
+	auto ext = Traits::template create<Point>(7, 8);
+	v8::Local<v8::Object> ext_obj = v8pp::class_<Point, Traits>::reference_external(isolate, ext);
+	check("Point referenced", v8pp::class_<Point, Traits>::unwrap_object(isolate, ext_obj) == ext);
+	check_eq("Point instances", Point::instance_count, 5);
+
+	Point_class.identity_tracking(false);
+	try
+	{
+		Point_class.identity_tracking(true);
+		check("identity tracking change with wrapped objects", false);
+	}
+	catch (std::exception const&)
+	{
+	}
+
+	run_script<int>(context, "v = a = b = null; for (i = 0; i < 10; ++i) { new Point(i, i); } 0");
+	isolate->RequestGarbageCollectionForTesting(
+		v8::Isolate::GarbageCollectionType::kFullGarbageCollection);
+	check_eq("Point instances after GC", Point::instance_count, 2);
+	check("Point sweeps", v8pp::class_<Point, Traits>::sweep_stats(isolate).objects >= 10);
+
+	run_script<int>(context, "a = new Point(0, 0); 0");
+	v8pp::class_<Point, Traits>::destroy(isolate);
+	check_eq("Point instances after class_<Point>::destroy", Point::instance_count, 2);
+	Traits::destroy(ext);
+}
+
+struct Samples
+{
+	std::vector<double> values;
+
+	double get(uint32_t index) const { return values[index]; }
+	void set(uint32_t index, double value) { values[index] = value; }
+	size_t size() const { return values.size(); }
+};
+
+struct Text
+{
+	std::string str;
+};
+
+void test_indexer()
+{
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	v8pp::class_<Samples> Samples_class(isolate);
+	Samples_class
+		.ctor<>()
+		.indexer(&Samples::get, &Samples::set, &Samples::size)
+		;
+
+	v8pp::class_<Text> Text_class(isolate);
+	Text_class
+		.indexer([](Text const& text, uint32_t index) { return text.str.substr(index, 1); },
+			[](Text const& text) { return text.str.size(); })
+		;
+
+	Samples samples{ { 1, 2, 3 } };
+	Text text{ "abc" };
+	context
+		.class_("Samples", Samples_class)
+		.value("s", v8pp::class_<Samples>::reference_external(isolate, &samples))
+		.value("str", v8pp::class_<Text>::reference_external(isolate, &text))
+		;
+
+	check_eq("indexer length", run_script<int>(context, "s.length"), 3);
+	check_eq("indexer get", run_script<double>(context, "s[0] + s[1] + s[2]"), 6.0);
+	check("indexer get out of range", run_script<bool>(context, "s[3] === undefined && !(3 in s)"));
+	check_eq("indexer set", run_script<double>(context, "s[1] = 5; s[1]"), 5.0);
+	check_eq("indexer set in C++", samples.values[1], 5.0);
+	check_eq("indexer set invalid value", run_script<double>(context, "s[1] = 'abc'; s[1]"), 5.0);
+	check_ex<std::runtime_error>("indexer set invalid value in strict mode", [&context]()
+	{
+		run_script<double>(context, "'use strict'; s[1] = 'abc'; s[1]");
+	});
+	check_eq("indexer delete", run_script<bool>(context, "delete s[0]"), false);
+	check_eq("indexer keys", run_script<std::string>(context, "Object.keys(s).join()"), "0,1,2");
+	check("indexer in", run_script<bool>(context, "0 in s && 2 in s"));
+	check_eq("indexer loop", run_script<double>(context, "n = 0; for (i = 0; i < s.length; ++i) n += s[i]; n"), 9.0);
+	check_eq("indexer new object", run_script<int>(context, "new Samples().length"), 0);
+
+	samples.values.push_back(4);
+	check_eq("indexer C++ length change", run_script<int>(context, "s.length + s[3]"), 8);
+
+	check_eq("read-only indexer", run_script<std::string>(context, "str[0] = 'x'; str[0] + str[1] + str[2] + str.length"), "abc3");
+	check_ex<std::runtime_error>("read-only indexer in strict mode", [&context]()
+	{
+		run_script<std::string>(context, "'use strict'; str[0] = 'x'; str[0]");
+	});
+}
+
+struct Sequence
+{
+	std::vector<int> items;
+
+	auto begin() const { return items.begin(); }
+	auto end() const { return items.end(); }
+};
+
+struct Buffer : Sequence
+{
+};
+
+void test_iterable()
+{
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	v8pp::class_<Sequence> Sequence_class(isolate);
+	Sequence_class
+		.ctor<>()
+		.iterable()
+		;
+
+	v8pp::class_<Buffer> Buffer_class(isolate);
+	Buffer_class
+		.iterable(2)
+		;
+
+	Sequence sequence{ { 1, 2, 3 } };
+	Buffer buffer{ { { 1, 2, 3, 4, 5 } } };
+	context
+		.class_("Sequence", Sequence_class)
+		.value("seq", v8pp::class_<Sequence>::reference_external(isolate, &sequence))
+		.value("buf", v8pp::class_<Buffer>::reference_external(isolate, &buffer))
+		.function("squares", [](int count)
+		{
+			return v8pp::make_lazy_range(std::views::iota(0, count)
+				| std::views::transform([](int n) { return n * n; }));
+		})
+		.function("words", []()
+		{
+			return v8pp::make_lazy_range(std::vector<std::string>{ "a", "b", "c" }, 2);
+		})
+		;
+
+	check_eq("for-of", run_script<int>(context, "n = 0; for (x of seq) n += x; n"), 6);
+	check_eq("spread", run_script<std::string>(context, "[...seq].join()"), "1,2,3");
+	check_eq("new object", run_script<int>(context, "[...new Sequence()].length"), 0);
+	check_eq("next", run_script<std::string>(context,
+		"it = seq[Symbol.iterator](); r = [it.next().value, it.next().value, it.next().value, it.next().done].join()"),
+		"1,2,3,true");
+	check("iterator is iterable", run_script<bool>(context, "it[Symbol.iterator]() === it"));
+	check("iterator is not enumerable", run_script<bool>(context, "Object.keys(seq).length == 0"));
+
+	sequence.items.push_back(4);
+	check_eq("C++ range change", run_script<int>(context, "n = 0; for (x of seq) n += x; n"), 10);
+
+	check_eq("chunks", run_script<std::string>(context, "[...buf].map(c => '[' + c + ']').join()"), "[1,2],[3,4],[5]");
+
+	check_eq("lazy range", run_script<std::string>(context, "[...squares(4)].join()"), "0,1,4,9");
+	check_eq("lazy range break", run_script<int>(context, "n = 0; for (x of squares(1000000)) { if (x > 100) break; n += x }; n"), 385);
+	check_eq("owning lazy range chunks", run_script<std::string>(context,
+		"[...words()].map(c => c.join('')).join()"), "ab,c");
+
+	check_ex<std::runtime_error>("not iterable object", [&context]()
+	{
+		run_script<int>(context, "seq[Symbol.iterator].call({})");
+	});
+}
+
+void test_lazy_array()
+{
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	context
+		.function("numbers", [](int count)
+		{
+			std::vector<int> numbers(count);
+			std::iota(numbers.begin(), numbers.end(), 0);
+			return v8pp::make_lazy_array(std::move(numbers));
+		})
+		.function("pairs", [](bool cache)
+		{
+			return v8pp::make_lazy_array(std::vector<std::map<std::string, int>>{ { { "a", 1 } }, { { "b", 2 } } }, cache);
+		})
+		;
+
+	check_eq("length", run_script<int>(context, "a = numbers(1000000); a.length"), 1000000);
+	check_eq("get", run_script<int>(context, "a[0] + a[1] + a[999999]"), 1000000);
+	check("get out of range", run_script<bool>(context, "a[1000000] === undefined"));
+	check_eq("set", run_script<int>(context, "a[1] = 5; a[1]"), 5);
+	check_eq("iterate", run_script<int>(context, "n = 0; for (x of numbers(5)) n += x; n"), 10);
+	check_eq("array methods", run_script<std::string>(context, "Array.prototype.slice.call(numbers(3)).join()"), "0,1,2");
+
+	check("not cached", run_script<bool>(context, "p = pairs(false); p[0] !== p[0] && p[1].b == 2"));
+	check("cached", run_script<bool>(context, "p = pairs(true); p[0] === p[0] && p[1].b == 2"));
+	check_eq("set cached", run_script<int>(context, "p[0] = { a: 3 }; p[0].a"), 3);
+	check("empty", run_script<bool>(context, "q = numbers(0); q.length == 0 && q[0] === undefined"));
+}
+
+struct Frame
+{
+	uint32_t id;
+	float x, y;
+	double time;
+	bool valid;
+};
+
+template<>
+struct v8pp::record<Frame>
+{
+	static constexpr auto fields = std::make_tuple(
+		v8pp::field("id", &Frame::id),
+		v8pp::field("x", &Frame::x),
+		v8pp::field("y", &Frame::y),
+		v8pp::field("time", &Frame::time),
+		v8pp::field("valid", &Frame::valid));
+};
+
+void test_record_view()
+{
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	std::vector<Frame> frames{ { 1, 1.5f, 2.5f, 0.25, true }, { 2, -1.0f, 0.0f, 0.5, false }, { 3, 0.0f, 4.0f, 0.75, true } };
+#ifndef V8_ENABLE_SANDBOX
+	Frame const* records = frames.data();
+#endif
+
+	v8::Local<v8::ArrayBuffer> buffer = v8pp::record_view<Frame>::buffer(isolate, std::move(frames));
+	Frame const* data = static_cast<Frame const*>(buffer->Data());
+#ifndef V8_ENABLE_SANDBOX
+	check("buffer without copying", data == records);
+#endif
+
+	auto Frame_view = v8pp::record_view<Frame>::bind(isolate);
+	context
+		.class_("FrameView", Frame_view)
+		.value("frames", buffer)
+		;
+
+	check_eq("BYTES_PER_RECORD", run_script<size_t>(context, "FrameView.BYTES_PER_RECORD"), sizeof(Frame));
+	check_eq("buffer size", run_script<size_t>(context, "frames.byteLength"), 3 * sizeof(Frame));
+	check_eq("view length", run_script<int>(context, "v = new FrameView(frames); v.length"), 3);
+	check_eq("read fields", run_script<double>(context, "v.id + v.x + v.y + v.time"), 5.25);
+	check_eq("index", run_script<std::string>(context,
+		"r = []; for (v.index = 0; v.index < v.length - 1; ++v.index) r.push(v.id); r.push(v.id); r.join()"), "1,2,3");
+	check_eq("write field", run_script<float>(context, "v.index = 1; v.x = 10; v.x"), 10.0f);
+	check_eq("write field in place", data[1].x, 10.0f);
+	check_eq("write bool field", run_script<bool>(context, "v.valid = true; v.valid"), true);
+	check("write bool field in place", data[1].valid);
+	check_eq("view with index", run_script<uint32_t>(context, "new FrameView(frames, 2).id"), 3u);
+	check_eq("typed array view", run_script<uint32_t>(context,
+		"new FrameView(new Uint8Array(frames, FrameView.BYTES_PER_RECORD)).id"), 2u);
+	check_eq("same buffer", run_script<uint32_t>(context, "w = new FrameView(frames, 2); w.id = 7; v.index = 2; v.id"), 7u);
+	check_eq("fields are enumerable", run_script<std::string>(context, "Object.keys(v).sort().join()"), "id,time,valid,x,y");
+
+	check_ex<std::runtime_error>("index out of range", [&context]()
+	{
+		run_script<int>(context, "'use strict'; v.index = 3");
+	});
+	check_eq("index error message", run_script<std::string>(context,
+		"'use strict'; try { v.index = 3; } catch (e) { e.message }"), "record index out of range");
+	check_eq("field error message", run_script<std::string>(context,
+		"'use strict'; try { v.id = 'x'; } catch (e) { e.message }"), "expected Number, typeof=string");
+	check_ex<std::runtime_error>("no buffer", [&context]()
+	{
+		run_script<int>(context, "new FrameView(1)");
+	});
+	check_ex<std::runtime_error>("misaligned buffer", [&context]()
+	{
+		run_script<int>(context, "new FrameView(new Uint8Array(frames, 1))");
+	});
+}
+
+struct Widget
+{
+	int id;
+	explicit Widget(int id) : id(id) {}
+};
+
+struct Sprocket
+{
+};
+
+template<typename Traits>
+void test_bulk_unwrap()
+{
+	using Widget_ptr = typename v8pp::class_<Widget, Traits>::object_pointer_type;
+
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	v8pp::class_<Widget, Traits> Widget_class(isolate);
+	Widget_class
+		.template ctor<int>()
+		.var("id", &Widget::id)
+		;
+	context.class_("Widget", Widget_class);
+
+	v8::Local<v8::Value> widgets = context.run_script("w = new Widget(1); [w, new Widget(2), Object.create(w), null, 3]");
+	auto const objects = v8pp::from_v8<std::vector<Widget_ptr>>(isolate, widgets);
+	check_eq("unwrapped count", objects.size(), 5u);
+	check_eq("unwrapped objects", objects[0]->id + objects[1]->id, 3);
+	check("unwrapped from prototype", objects[2] == objects[0]);
+	check("not unwrapped", !objects[3] && !objects[4]);
+
+	auto const pair = v8pp::from_v8<std::array<Widget_ptr, 2>>(isolate, context.run_script("[w, w]"));
+	check("unwrapped array", pair[0] == objects[0] && pair[1] == objects[0]);
+
+	v8::Local<v8::Context> current = isolate->GetCurrentContext();
+	v8::Local<v8::Array> array = v8pp::to_v8(isolate, objects);
+	v8::Local<v8::Value> w = current->Global()->Get(current, v8pp::to_v8(isolate, "w")).ToLocalChecked();
+	check_eq("wrapped count", array->Length(), 5u);
+	check("wrapped objects", array->Get(current, 0).ToLocalChecked()->StrictEquals(w)
+		&& array->Get(current, 2).ToLocalChecked()->StrictEquals(w));
+	check("null for not wrapped", array->Get(current, 3).ToLocalChecked()->IsNull());
+
+	// empty input doesn't require a registered class
+	using Sprocket_class = v8pp::class_<Sprocket, Traits>;
+	std::vector<typename Sprocket_class::object_pointer_type> sprockets;
+	Sprocket_class::unwrap_objects(isolate, current, v8::Array::New(isolate), std::back_inserter(sprockets));
+	check("unwrap empty array", sprockets.empty());
+	check_eq("find empty range", Sprocket_class::find_objects(isolate, current, sprockets)->Length(), 0u);
+}
+
+struct Gadget
+{
+	int value = 5;
+	int get() const { return value; }
+};
+
+template<typename Traits>
+void test_deferred_templates()
+{
+	v8pp::context context;
+	v8::Isolate* isolate = context.isolate();
+	v8::HandleScope scope(isolate);
+
+	v8pp::class_<Gadget, Traits> Gadget_class(isolate);
+	Gadget_class
+		.template ctor<>()
+		.var("value", &Gadget::value)
+		.function("get", &Gadget::get)
+		.const_("answer", 42)
+		;
+	{
+		std::string const kind = "deferred gadget";
+		Gadget_class.const_("kind", std::string_view(kind));
+	}
+
+	auto& registry = v8pp::detail::classes::find<Traits>(isolate, v8pp::detail::type_id<Gadget>());
+	check("class templates deferred", !registry.has_templates());
+
+	context.value("gadget", v8pp::class_<Gadget, Traits>::create_object(isolate));
+	check("class templates created on wrap", registry.has_templates());
+	check_eq("deferred bindings", run_script<int>(context,
+		"gadget.value + gadget.get() + gadget.answer"), 52);
+	check_eq("deferred string_view constant", run_script<std::string>(context, "gadget.kind"), "deferred gadget");
+}
+
 void test_class()
 {
 	test_class_<v8pp::raw_ptr_traits>();
@@ -490,4 +1118,24 @@ void test_class()
 
 	test_auto_wrap_objects<v8pp::raw_ptr_traits>();
 	test_auto_wrap_objects<v8pp::shared_ptr_traits>();
+
+	test_unique_ptr();
+	test_intrusive_ptr();
+
+	test_destroy_in_background();
+
+	test_identity_tracking<v8pp::raw_ptr_traits>();
+	test_identity_tracking<v8pp::shared_ptr_traits>();
+
+
+	test_indexer();
+	test_iterable();
+	test_lazy_array();
+	test_record_view();
+
+	test_bulk_unwrap<v8pp::raw_ptr_traits>();
+	test_bulk_unwrap<v8pp::shared_ptr_traits>();
+
+	test_deferred_templates<v8pp::raw_ptr_traits>();
+	test_deferred_templates<v8pp::shared_ptr_traits>();
 }
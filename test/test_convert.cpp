@@ -1,5 +1,9 @@
 #include "v8pp/convert.hpp"
 #include "v8pp/class.hpp"
+#include "v8pp/json.hpp"
+#include "v8pp/call_v8.hpp"
+#include "v8pp/function.hpp"
+#include "v8pp/object.hpp"
 
 #include "test.hpp"
 
@@ -450,6 +454,283 @@ void test_convert_variant(v8::Isolate* isolate)
 	optional_check(0, std::optional<std::string>{}, false);
 }
 
+void test_convert_map_set(v8pp::context& context)
+{
+	v8::Isolate* isolate = context.isolate();
+
+	test_conv(isolate, std::set<int>{ 1, 2, 3 });
+	test_conv(isolate, std::unordered_set<std::string>{ "a", "b" });
+	check("set to Set", v8pp::to_v8(isolate, std::set<int>{ 1, 2 })->IsSet());
+	check_eq("Array to set", v8pp::from_v8<std::set<int>>(isolate, context.run_script("[3, 1, 3]")),
+		std::set<int>{ 1, 3 });
+	check_eq("Array to multiset", v8pp::from_v8<std::multiset<int>>(isolate, context.run_script("[3, 1, 3]")),
+		std::multiset<int>{ 1, 3, 3 });
+
+	std::map<int, std::string> const map{ { 1, "a" }, { 2, "b" } };
+	v8::Local<v8::Map> js_map = v8pp::to_v8(isolate, v8pp::js_map<std::map<int, std::string>>{ map });
+	check_eq("js_map size", js_map->Size(), 2u);
+	check("js_map integer keys", js_map->Has(isolate->GetCurrentContext(), v8pp::to_v8(isolate, 1)).FromJust());
+	check_eq("Map to map", v8pp::from_v8<std::map<int, std::string>>(isolate, js_map), map);
+	check_eq("Map to js_map", v8pp::from_v8<v8pp::js_map<std::map<int, std::string>>>(isolate, js_map).values, map);
+	check_eq("Map to unordered_map", v8pp::from_v8<std::unordered_map<int, std::string>>(isolate,
+		context.run_script("new Map([[1, 'a'], [2, 'b']])")),
+		std::unordered_map<int, std::string>(map.begin(), map.end()));
+	check_eq("own object keys", v8pp::from_v8<std::map<std::string, int>>(isolate,
+		context.run_script("o = Object.create({ inherited: 1 }); o.own = 2; o[Symbol()] = 3; o")),
+		(std::map<std::string, int>{ { "own", 2 } }));
+	check_eq("integer object keys", v8pp::from_v8<std::unordered_map<int, int>>(isolate,
+		context.run_script("({ 1: 10, 2: 20 })")), (std::unordered_map<int, int>{ { 1, 10 }, { 2, 20 } }));
+	check_eq("mixed object keys", v8pp::from_v8<std::map<std::string, int>>(isolate,
+		context.run_script("({ 1: 10, b: 20 })")), (std::map<std::string, int>{ { "1", 10 }, { "b", 20 } }));
+	check_eq("object from map", v8pp::json_str(isolate,
+		v8pp::to_v8(isolate, std::map<std::string, int>{ { "a", 1 }, { "1", 2 } })), R"({"1":2,"a":1})");
+	context.value("object_from_map", v8pp::to_v8(isolate, std::map<int, int>{ { 1, 2 } }));
+	check("object from map prototype", run_script<bool>(context, "Object.getPrototypeOf(object_from_map) === Object.prototype"));
+	check_ex<v8pp::invalid_argument>("Object to js_map", [isolate]()
+	{
+		v8pp::from_v8<v8pp::js_map<std::map<int, std::string>>>(isolate, v8::Object::New(isolate));
+	});
+
+	check_eq("Set to vector", v8pp::from_v8<std::vector<int>>(isolate,
+		context.run_script("new Set([1, 2, 3])")), std::vector<int>{ 1, 2, 3 });
+	check_eq("iterable to vector", v8pp::from_v8<std::vector<int>>(isolate,
+		context.run_script("(function* () { yield 1; yield 2; })()")), std::vector<int>{ 1, 2 });
+	check("iterable is valid", v8pp::convert<std::vector<int>>::is_valid(isolate,
+		context.run_script("(function* () { yield 1; })()")));
+	check("iterable is valid for set", v8pp::convert<std::set<int>>::is_valid(isolate,
+		context.run_script("new Map()")));
+	check("object is valid without iterator lookup", v8pp::convert<std::vector<int>>::is_valid(isolate,
+		context.run_script("({ get [Symbol.iterator]() { throw new Error('iterator lookup'); } })")));
+	try
+	{
+		v8pp::from_v8<std::vector<int>>(isolate, context.run_script("(function* () { yield 1; throw new Error('broken'); })()"));
+		check("iteration error", false);
+	}
+	catch (std::runtime_error const& ex)
+	{
+		check_eq("iteration error message", std::string(ex.what()), "Error: broken");
+	}
+	check_eq("typed array to vector", v8pp::from_v8<std::vector<double>>(isolate,
+		context.run_script("new Float64Array([0.5, 1.5])")), std::vector<double>{ 0.5, 1.5 });
+	check_eq("iterable to array", v8pp::from_v8<std::array<int, 2>>(isolate,
+		context.run_script("new Set([1, 2])")), (std::array<int, 2>{ 1, 2 }));
+	check_ex<v8pp::invalid_argument>("not iterable to vector", [isolate]()
+	{
+		v8pp::from_v8<std::vector<int>>(isolate, v8::Object::New(isolate));
+	});
+}
+
+void test_convert_interned_string(v8pp::context& context)
+{
+	v8::Isolate* isolate = context.isolate();
+
+	auto const tags = v8pp::from_v8<std::vector<v8pp::interned_string>>(isolate,
+		context.run_script("['red', 'green', 'red', 'gr' + 'een', 1]"));
+	check_eq("interned count", tags.size(), 5u);
+	check_eq("interned value", tags[0].str(), "red");
+	check("same string shared", tags[0].c_str() == tags[2].c_str());
+	check("computed string shared", tags[1].c_str() == tags[3].c_str());
+	check("different strings", tags[0] != tags[1]);
+	check_eq("number", tags[4].view(), "1");
+
+	v8pp::interned_string const red = v8pp::from_v8<v8pp::interned_string>(isolate, v8pp::to_v8(isolate, "red"));
+	check("interned again", red == tags[0] && red.c_str() == tags[0].c_str());
+	check("hash", std::hash<v8pp::interned_string>{}(red) == std::hash<std::string_view>{}("red"));
+	check("default", v8pp::interned_string{}.empty() && v8pp::interned_string{} == v8pp::from_v8<v8pp::interned_string>(isolate, v8pp::to_v8(isolate, "")));
+	check("to_v8", v8pp::to_v8(isolate, red)->StrictEquals(v8pp::to_v8(isolate, "red")));
+
+	auto const counts = v8pp::from_v8<std::unordered_map<v8pp::interned_string, int>>(isolate,
+		context.run_script("({ red: 1, green: 2 })"));
+	check_eq("interned map keys", counts.at(red), 1);
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		v8pp::from_v8<v8pp::interned_string>(isolate, v8pp::to_v8(isolate, std::to_string(i)));
+	}
+	check("evicted unused", red.c_str() == v8pp::from_v8<v8pp::interned_string>(isolate, v8pp::to_v8(isolate, "red")).c_str());
+
+	v8pp::detail::string_table::remove(isolate);
+	check_eq("after table removal", red.str(), "red");
+	check("to_v8 after table removal", v8pp::to_v8(isolate, red)->StrictEquals(v8pp::to_v8(isolate, "red")));
+	check("compared by value after table removal", red == v8pp::from_v8<v8pp::interned_string>(isolate, v8pp::to_v8(isolate, "red")));
+
+	check_ex<v8pp::invalid_argument>("not a string", [isolate]()
+	{
+		v8pp::from_v8<v8pp::interned_string>(isolate, v8::Object::New(isolate));
+	});
+}
+
+struct Sample
+{
+	double value;
+	float weight;
+	int32_t id;
+	uint8_t flags;
+	int64_t time;
+	bool valid;
+	std::string label; // not a column
+};
+
+template<>
+struct v8pp::record<Sample>
+{
+	static constexpr auto fields = std::make_tuple(
+		v8pp::field("value", &Sample::value),
+		v8pp::field("weight", &Sample::weight),
+		v8pp::field("id", &Sample::id),
+		v8pp::field("flags", &Sample::flags),
+		v8pp::field("time", &Sample::time),
+		v8pp::field("valid", &Sample::valid));
+};
+
+void test_convert_columnar(v8::Isolate* isolate)
+{
+	v8pp::columnar<Sample> samples;
+	samples.rows.push_back({ 1.5, 0.5f, 1, 2, -3, true, "a" });
+	samples.rows.push_back({ -2.5, 1.0f, -4, 255, 1LL << 40, false, "b" });
+
+	v8::Local<v8::Object> columns = v8pp::to_v8(isolate, samples);
+	v8::Local<v8::Context> context = isolate->GetCurrentContext();
+	auto column = [&](char const* name)
+	{
+		return columns->Get(context, v8pp::to_v8(isolate, name)).ToLocalChecked();
+	};
+	check("value column", column("value")->IsFloat64Array());
+	check("weight column", column("weight")->IsFloat32Array());
+	check("id column", column("id")->IsInt32Array());
+	check("flags column", column("flags")->IsUint8Array());
+	check("time column", column("time")->IsBigInt64Array());
+	check("valid column", column("valid")->IsUint8Array());
+	check("no label column", column("label")->IsUndefined());
+	check_eq("column length", column("id").As<v8::TypedArray>()->Length(), 2u);
+
+	auto const rows = v8pp::from_v8<v8pp::columnar<Sample>>(isolate, columns).rows;
+	check_eq("rows size", rows.size(), 2u);
+	for (size_t i = 0; i < rows.size(); ++i)
+	{
+		Sample const& expected = samples.rows[i];
+		check("row " + std::to_string(i), rows[i].value == expected.value && rows[i].weight == expected.weight
+			&& rows[i].id == expected.id && rows[i].flags == expected.flags
+			&& rows[i].time == expected.time && rows[i].valid == expected.valid && rows[i].label.empty());
+	}
+
+	check_ex<v8pp::invalid_argument>("wrong column type", [isolate, columns, context]()
+	{
+		columns->Set(context, v8pp::to_v8(isolate, "id"), v8pp::to_v8(isolate, { 1, 2 })).FromJust();
+		v8pp::from_v8<v8pp::columnar<Sample>>(isolate, columns);
+	});
+	check_ex<std::invalid_argument>("column length mismatch", [isolate, columns, context]()
+	{
+		columns->Set(context, v8pp::to_v8(isolate, "id"), v8::Int32Array::New(v8::ArrayBuffer::New(isolate, 4), 0, 1)).FromJust();
+		v8pp::from_v8<v8pp::columnar<Sample>>(isolate, columns);
+	});
+}
+
+// value offset by the `tag` global variable of a context
+struct Tagged
+{
+	int value;
+
+	bool operator==(Tagged const& other) const = default;
+
+	friend std::ostream& operator<<(std::ostream& os, Tagged const& t)
+	{
+		return os << "tagged: " << t.value;
+	}
+};
+
+template<>
+struct v8pp::convert<Tagged>
+{
+	using from_type = Tagged;
+	using to_type = v8::Local<v8::Number>;
+
+	static int context_calls;
+
+	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
+	{
+		return !value.IsEmpty() && value->IsNumber();
+	}
+
+	static int tag(v8::Isolate* isolate, v8::Local<v8::Context> context)
+	{
+		++context_calls;
+		v8::Local<v8::Value> tag = context->Global()->Get(context, v8pp::to_v8(isolate, "tag")).ToLocalChecked();
+		return tag->Int32Value(context).FromMaybe(0);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+	{
+		return Tagged{ value->Int32Value(context).FromJust() - tag(isolate, context) };
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, Tagged const& t)
+	{
+		return to_v8(isolate, isolate->GetCurrentContext(), t);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, Tagged const& t)
+	{
+		return v8::Integer::New(isolate, t.value + tag(isolate, context));
+	}
+};
+
+int v8pp::convert<Tagged>::context_calls = 0;
+
+void test_convert_in_context(v8pp::context& context)
+{
+	v8::Isolate* isolate = context.isolate();
+	v8::Local<v8::Context> current = isolate->GetCurrentContext();
+	v8::Local<v8::Context> other = v8::Context::New(isolate);
+	other->Global()->Set(other, v8pp::to_v8(isolate, "tag"), v8pp::to_v8(isolate, 100)).FromJust();
+
+	int& context_calls = v8pp::convert<Tagged>::context_calls;
+
+	// the context passes through nested converters
+	v8::Local<v8::Value> array = context.run_script("[101, 102, null]");
+	check_eq("vector in context", v8pp::from_v8<std::vector<std::optional<Tagged>>>(isolate, other, array),
+		(std::vector<std::optional<Tagged>>{ Tagged{ 1 }, Tagged{ 2 }, std::nullopt }));
+	check_eq("vector in current context", v8pp::from_v8<std::vector<std::optional<Tagged>>>(isolate, array),
+		(std::vector<std::optional<Tagged>>{ Tagged{ 101 }, Tagged{ 102 }, std::nullopt }));
+	check_eq("map in context", (v8pp::from_v8<std::map<std::string, Tagged>>(isolate, other, context.run_script("({ a: 110 })"))),
+		(std::map<std::string, Tagged>{ { "a", Tagged{ 10 } } }));
+	check_eq("tuple in context", (v8pp::from_v8<std::tuple<int, Tagged>>(isolate, other, context.run_script("[1, 120]"))),
+		std::make_tuple(1, Tagged{ 20 }));
+	check_eq("to_v8 in context", v8pp::json_str(isolate,
+		v8pp::to_v8(isolate, other, std::vector<Tagged>{ Tagged{ 1 }, Tagged{ 2 } })), "[101,102]");
+	check_eq("from_v8 with default", v8pp::from_v8<int>(isolate, context.run_script("'x'"), 42), 42);
+
+	// options
+	v8::Local<v8::Object> options = v8::Object::New(isolate);
+	check("set_option in context", v8pp::set_option(isolate, other, options, "value", Tagged{ 5 }));
+	check("set_option literal in context", v8pp::set_option(isolate, other, options, "name", "abc"));
+	Tagged value{};
+	check("get_option in context", v8pp::get_option(isolate, other, options, "value", value));
+	check_eq("get_option value", value, Tagged{ 5 });
+	check("get_option in current", v8pp::get_option(isolate, current, options, "value", value));
+	check_eq("get_option current value", value, Tagged{ 105 });
+
+	// the current context is fetched once for all arguments of a wrapped function
+	v8::Local<v8::Function> sum = v8pp::wrap_function(isolate, "sum", [](std::vector<Tagged> const& values, Tagged extra)
+	{
+		int result = extra.value;
+		for (Tagged const& t : values) result += t.value;
+		return result;
+	});
+	current->Global()->Set(current, v8pp::to_v8(isolate, "sum"), sum).FromJust();
+	context_calls = 0;
+	check_eq("wrapped function", run_script<int>(context, "sum([1, 2, 3], 4)"), 10);
+	check_eq("context converter calls", context_calls, 4);
+
+	check_eq("call_v8 in context", v8pp::from_v8<int>(isolate,
+		v8pp::call_v8(isolate, other, sum, other->Global(), std::vector<Tagged>{ Tagged{ 1 } }, Tagged{ 2 })), 203);
+}
+
 void test_convert()
 {
 	v8pp::context context;
@@ -503,4 +784,8 @@ void test_convert()
 	test_convert_optional(isolate);
 	test_convert_tuple(isolate);
 	test_convert_variant(isolate);
+	test_convert_columnar(isolate);
+	test_convert_map_set(context);
+	test_convert_interned_string(context);
+	test_convert_in_context(context);
 }
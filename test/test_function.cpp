@@ -1,8 +1,13 @@
 #include "v8pp/function.hpp"
+#include "v8pp/class.hpp"
 #include "v8pp/context.hpp"
 
 #include "test.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <memory_resource>
+
 static int f(int const& x) { return x; }
 static std::string g(char const* s) { return s ? s : ""; }
 static int h(v8::Isolate*, int x, int y) { return x + y; }
@@ -12,6 +17,169 @@ struct X
 	int operator()(int x) const { return -x; }
 };
 
+struct counting_resource : std::pmr::memory_resource
+{
+	size_t count = 0;
+
+	void* do_allocate(size_t bytes, size_t alignment) override
+	{
+		++count;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+	{
+		std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+	}
+
+	bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+
+struct Bag
+{
+	std::pmr::vector<int> items;
+
+	explicit Bag(std::pmr::vector<int> items)
+		: items(std::move(items))
+	{
+	}
+
+	size_t count_with(std::pmr::vector<int> const& more) const { return items.size() + more.size(); }
+};
+
+void test_pmr_arguments(v8pp::context& context)
+{
+	v8::Isolate* isolate = context.isolate();
+
+	std::pmr::memory_resource* resource = nullptr;
+	bool same_resource = false;
+	context.function("total_size", v8pp::with_call_arena([&resource, &same_resource](std::pmr::vector<std::pmr::string> const& items)
+	{
+		resource = items.get_allocator().resource();
+		same_resource = std::all_of(items.begin(), items.end(),
+			[resource](std::pmr::string const& item) { return item.get_allocator().resource() == resource; });
+		size_t size = 0;
+		for (auto const& item : items) size += item.size();
+		return size;
+	}));
+
+	counting_resource counter;
+	std::pmr::memory_resource* default_resource = std::pmr::set_default_resource(&counter);
+
+	check_eq("pmr arguments", run_script<int>(context, "total_size(['a', 'bb', 'ccc'])"), 6);
+	check("arena resource", resource != &counter && same_resource);
+	check_eq("large pmr arguments", run_script<int>(context,
+		"total_size(Array.from({ length: 1000 }, () => 'a long enough string to be allocated'))"), 36000);
+	check_eq("no default resource allocations", counter.count, 0u);
+
+	auto const numbers = v8pp::from_v8<std::pmr::vector<int>>(isolate, v8pp::to_v8(isolate, { 1, 2, 3 }));
+	check("default resource outside of a call", numbers.get_allocator().resource() == &counter && counter.count > 0);
+
+	// without opt-in std::pmr arguments use the default resource and may be kept
+	std::pmr::vector<std::pmr::string> kept;
+	context.function("keep", [&kept](std::pmr::vector<std::pmr::string> items) { kept = std::move(items); });
+	run_script<int>(context, "keep(['a long enough string to be allocated', 'b']); 0");
+	run_script<int>(context, "total_size(['another long enough string to be allocated']); 0");
+	check("kept pmr argument", kept.size() == 2 && kept[0] == "a long enough string to be allocated" && kept[1] == "b");
+	check("kept pmr argument resource", kept.get_allocator().resource() == &counter);
+
+	// a constructor called from a wrapped function doesn't use its call arena
+	v8pp::class_<Bag> bag_class(isolate);
+	bag_class
+		.ctor<std::pmr::vector<int>>()
+		.function("count_with", v8pp::with_call_arena(&Bag::count_with))
+		;
+	context.class_("Bag", bag_class);
+	context.function("nested", v8pp::with_call_arena([](std::pmr::vector<int> const& items, v8pp::js_function<void()> const& callback)
+	{
+		callback();
+		return items.size();
+	}));
+	check_eq("nested call", run_script<int>(context,
+		"var bag; nested([1, 2], () => { bag = new Bag([3, 4, 5]); })"), 2);
+	Bag const* bag = v8pp::from_v8<Bag*>(isolate, context.run_script("bag"));
+	check("nested constructor resource", bag && bag->items.get_allocator().resource() == &counter);
+	run_script<int>(context, "nested([6, 7, 8, 9], () => {})");
+	check("nested constructor arguments", bag && bag->items == std::pmr::vector<int>{ 3, 4, 5 });
+	size_t const allocations = counter.count;
+	check_eq("member function with call arena", run_script<int>(context, "bag.count_with([1, 2])"), 5);
+	check_eq("member function arena allocations", counter.count, allocations);
+	v8pp::class_<Bag>::destroy_objects(isolate);
+
+	std::pmr::set_default_resource(default_resource);
+}
+
+void test_js_function(v8pp::context& context)
+{
+	v8::Isolate* isolate = context.isolate();
+
+	context.function("apply", [](std::function<int(int)> const& fn, int x) { return fn(x); });
+	check_eq("std::function argument", run_script<int>(context, "apply(x => x * 2, 21)"), 42);
+
+	v8::Local<v8::Value> twice = context.run_script("(function(x) { if (x < 0) throw new Error('negative'); return x * 2; })");
+	auto const fn1 = v8pp::from_v8<v8pp::js_function<int(int)>>(isolate, twice);
+	auto const fn2 = v8pp::from_v8<v8pp::js_function<int(int)>>(isolate, twice);
+	check_eq("js_function call", fn1(4), 8);
+	check("js_function cached", fn1 == fn2);
+	check("js_function other function", !(fn1 == v8pp::from_v8<v8pp::js_function<int(int)>>(isolate,
+		context.run_script("(function(x) { return x; })"))));
+	check_ex<std::runtime_error>("js_function exception", [&fn1]() { fn1(-1); });
+
+	for (int i = 0; i < 100; ++i)
+	{
+		auto const temp = v8pp::from_v8<v8pp::js_function<int(int)>>(isolate, context.run_script("(x => x)"));
+		check_eq("temporary js_function", temp(i), i);
+	}
+	check("js_function cached after expired ones", fn1 == v8pp::from_v8<v8pp::js_function<int(int)>>(isolate, twice));
+
+	v8pp::detail::js_function_cache::remove(isolate);
+	check_eq("js_function after cache removal", fn2(5), 10);
+	check("js_function cached again", !(fn1 == v8pp::from_v8<v8pp::js_function<int(int)>>(isolate, twice)));
+
+	auto const std_fn = v8pp::from_v8<std::function<double(double)>>(isolate, twice);
+	check_eq("std::function call", std_fn(1.5), 3.0);
+	check("std::function to_v8", v8pp::to_v8(isolate, std_fn)->StrictEquals(twice));
+
+	std::function<void(std::string)> const log = [](std::string const&) {};
+	check("std::function from C++", v8pp::to_v8(isolate, log)->IsFunction());
+	check_ex<v8pp::invalid_argument>("std::function from non-function", [isolate]()
+	{
+		v8pp::from_v8<std::function<void()>>(isolate, v8pp::to_v8(isolate, 1));
+	});
+}
+
+void test_wrap_function_cached(v8pp::context& context)
+{
+	v8::Isolate* isolate = context.isolate();
+
+	v8::Local<v8::Function> f1 = v8pp::wrap_function_cached(isolate, "f", f);
+	v8::Local<v8::Function> f2 = v8pp::wrap_function_cached(isolate, "f", &f);
+	check("cached function pointer", f1 == f2);
+	check("cached function other name", f1 != v8pp::wrap_function_cached(isolate, "f2", f));
+	check("cached function other pointer", f1 != v8pp::wrap_function_cached(isolate, "f", h));
+	check("not cached function", f1 != v8pp::wrap_function(isolate, "f", f));
+
+	auto negate = [](int x) { return -x; };
+	check("cached lambda", v8pp::wrap_function_cached(isolate, "negate", negate)
+		== v8pp::wrap_function_cached(isolate, "negate", negate));
+
+	auto const handler = std::make_shared<std::function<int(int)>>([](int x) { return x + 1; });
+	auto wrap_handler = [isolate, &handler]()
+	{
+		return v8pp::wrap_function_cached(isolate, "handler",
+			[handler](int x) { return (*handler)(x); }, handler.get());
+	};
+	check("cached callable identity", wrap_handler() == wrap_handler());
+
+	context.function("make_handler", wrap_handler);
+	check("cached function returned to JS", run_script<bool>(context, "make_handler() === make_handler()"));
+	check_eq("cached function call", run_script<int>(context, "make_handler()(1)"), 2);
+	check_eq("cached function name", run_script<std::string>(context, "make_handler().name"), "handler");
+}
+
 void test_function()
 {
 	v8pp::context context;
@@ -54,4 +222,8 @@ void test_function()
 	std::function<int(int)> fun = f;
 	context.function("fun", fun);
 	check_eq("fun", run_script<int>(context, "fun(42)"), 42);
+
+	test_pmr_arguments(context);
+	test_js_function(context);
+	test_wrap_function_cached(context);
 }
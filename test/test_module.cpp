@@ -1,4 +1,5 @@
 #include "v8pp/module.hpp"
+#include "v8pp/class.hpp"
 #include "v8pp/context.hpp"
 #include "v8pp/property.hpp"
 
@@ -8,6 +9,11 @@
 
 static std::string var;
 
+struct Gauge
+{
+	int level = 7;
+};
+
 static int fun(int x) { return x + 1; }
 
 static int x = 1;
@@ -27,6 +33,9 @@ void test_module()
 
 	v8pp::module module(context.isolate());
 	v8pp::module consts(context.isolate());
+	v8pp::module helpers(context.isolate());
+	v8pp::module shared1(context.isolate());
+	v8pp::module shared2(context.isolate());
 
 	consts
 		.const_("bool", true)
@@ -38,6 +47,9 @@ void test_module()
 
 	module
 		.submodule("consts", consts)
+		.submodule("helpers", helpers.function("inc", &fun).function("fun", fun))
+		.submodule("shared1", shared1.share_functions().function("inc", &fun))
+		.submodule("shared2", shared2.share_functions().function("inc", fun))
 		.var("var", var)
 		.function("fun", &fun)
 		.value("empty", v8::Null(context.isolate()))
@@ -68,4 +80,40 @@ void test_module()
 	check_eq("module.wrop",
 		run_script<int>(context, "++module.wprop"), 3);
 	check_eq("x", x, 2);
+
+	check_eq("module.helpers.inc",
+		run_script<int>(context, "module.helpers.inc(1)"), 2);
+	check("distinct functions", run_script<bool>(context,
+		"module.fun !== module.helpers.inc && module.helpers.inc !== module.helpers.fun"));
+	check("distinct function properties", run_script<bool>(context,
+		"module.fun.tag = 1; module.helpers.inc.tag === undefined"));
+	check("shared function template", run_script<bool>(context,
+		"module.shared1.inc === module.shared2.inc && module.shared1.inc !== module.fun"));
+
+	v8pp::class_<Gauge> Gauge_class(context.isolate());
+	Gauge_class
+		.ctor<>()
+		.var("level", &Gauge::level)
+		;
+
+	v8pp::module lazy(context.isolate());
+	lazy
+		.lazy()
+		.function("fun", &fun)
+		.function("lambda", [](int x) { return x * 2; })
+		.class_("Gauge", Gauge_class)
+		.lazy(false)
+		.function("eager", &fun)
+		;
+	context.module("lazy", lazy);
+
+	check_eq("lazy.fun", run_script<int>(context, "lazy.fun(1)"), 2);
+	check("lazy.fun materialized", run_script<bool>(context,
+		"lazy.fun === lazy.fun && Object.getOwnPropertyDescriptor(lazy, 'fun').writable"));
+	check_eq("lazy.lambda", run_script<int>(context, "lazy.lambda(4)"), 8);
+	check("lazy class templates before access", !Gauge_class.has_templates());
+	check_eq("lazy.Gauge", run_script<int>(context, "new lazy.Gauge().level"), 7);
+	check("lazy class templates after access", Gauge_class.has_templates());
+	check("lazy.Gauge instance", run_script<bool>(context, "new lazy.Gauge() instanceof lazy.Gauge"));
+	check_eq("lazy.eager", run_script<int>(context, "lazy.eager(2)"), 3);
 }
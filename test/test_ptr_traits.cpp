@@ -163,12 +163,80 @@ void test_shared_ptr_traits()
 	check_eq("shared_ptr_traits::object_size", traits::object_size<Y>(y), 100500u);
 }
 
+void test_unique_ptr_traits()
+{
+	using traits = v8pp::unique_ptr_traits;
+
+	X x;
+	traits::pointer_type ptr = &x;
+
+	static_assert(std::same_as<traits::pointer_type, void*>);
+	static_assert(std::same_as<traits::const_pointer_type, void const*>);
+
+	static_assert(std::same_as<traits::object_pointer_type<X>, X*>);
+	static_assert(std::same_as<traits::object_const_pointer_type<X>, X const*>);
+
+	static_assert(std::same_as<traits::object_id, void*>);
+	static_assert(std::same_as<traits::convert_ptr<X>, v8pp::convert<X*, traits>>);
+	static_assert(std::same_as<traits::convert_ref<X>, v8pp::convert<X, traits>>);
+
+	traits::object_id id = traits::pointer_id(ptr);
+	check_eq("unique_ptr_traits::pointer_id", id, &x);
+	check_eq("unique_ptr_traits::key", traits::key(id), ptr);
+	check_eq("unique_ptr_traits::const_pointer_cast", traits::const_pointer_cast(&x), ptr);
+	check_eq("unique_ptr_traits::static_pointer_cast", traits::static_pointer_cast<X>(ptr), &x);
+	check_eq("unique_ptr_traits::object_size", traits::object_size<X>(&x), sizeof(X));
+}
+
+struct Z
+{
+	int refs = 0;
+	static int destroyed;
+
+	Z() = default;
+	Z(Z const&) {} // reference counter is not copied
+
+	friend void intrusive_ptr_add_ref(Z* z) { ++z->refs; }
+	friend void intrusive_ptr_release(Z* z) { if (--z->refs == 0) { ++destroyed; delete z; } }
+};
+
+int Z::destroyed = 0;
+
+void test_intrusive_ptr_traits()
+{
+	using traits = v8pp::intrusive_ptr_traits;
+
+	static_assert(std::same_as<traits::pointer_type, void*>);
+	static_assert(std::same_as<traits::object_pointer_type<Z>, Z*>);
+	static_assert(std::same_as<traits::convert_ptr<Z>, v8pp::convert<Z*, traits>>);
+	static_assert(std::same_as<traits::convert_ref<Z>, v8pp::convert<Z, traits>>);
+
+	Z::destroyed = 0;
+
+	Z* z = traits::create<Z>();
+	check_eq("intrusive_ptr_traits::create refs", z->refs, 1);
+
+	Z* z2 = traits::clone(*z);
+	check_eq("intrusive_ptr_traits::clone refs", z2->refs, 1);
+	traits::destroy<Z>(z2);
+	check_eq("intrusive_ptr_traits::destroy clone", Z::destroyed, 1);
+
+	intrusive_ptr_add_ref(z);
+	traits::destroy<Z>(z);
+	check_eq("intrusive_ptr_traits::destroy with refs", Z::destroyed, 1);
+	check_eq("intrusive_ptr_traits::destroy refs", z->refs, 1);
+	traits::destroy<Z>(z);
+	check_eq("intrusive_ptr_traits::destroy last ref", Z::destroyed, 2);
+}
+
 } // unnamed namespace
 
 void test_ptr_traits()
 {
 	test_raw_ptr_traits();
 	test_shared_ptr_traits();
+	test_unique_ptr_traits();
+	test_intrusive_ptr_traits();
 
 	v8pp::context context;
 
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <memory_resource>
 #include <utility>
 
 #include <v8.h>
@@ -19,6 +21,134 @@ struct optional_count<std::tuple<Ts...>>
 	static constexpr size_t value = (0 + ... + is_optional<Ts>::value);
 };
 
+template<typename>
+struct has_pmr_container;
+
+template<typename... Ts>
+struct has_pmr_container<std::tuple<Ts...>>
+	: std::disjunction<is_pmr_container<std::remove_cvref_t<Ts>>...>
+{
+};
+
+/// Memory arena for std::pmr container arguments of a wrapped function call,
+/// seeded with an inline buffer and growing into a reusable thread-local pool
+class call_arena
+{
+public:
+	call_arena()
+		: resource_(buffer_, sizeof(buffer_), &pool())
+		, prev_(std::exchange(current(), this))
+	{
+	}
+
+	~call_arena()
+	{
+		current() = prev_;
+	}
+
+	call_arena(call_arena const&) = delete;
+	call_arena& operator=(call_arena const&) = delete;
+
+	/// Memory resource of the innermost call arena in the current thread,
+	/// or the default one
+	static std::pmr::memory_resource* current_resource()
+	{
+		call_arena* arena = current();
+		return arena ? &arena->resource_ : std::pmr::get_default_resource();
+	}
+
+private:
+	friend class no_call_arena;
+
+	static call_arena*& current()
+	{
+		thread_local call_arena* arena = nullptr;
+		return arena;
+	}
+
+	static std::pmr::memory_resource& pool()
+	{
+		thread_local std::pmr::unsynchronized_pool_resource pool(std::pmr::new_delete_resource());
+		return pool;
+	}
+
+	alignas(std::max_align_t) std::byte buffer_[1024];
+	std::pmr::monotonic_buffer_resource resource_;
+	call_arena* prev_;
+};
+
+/// Scope without a call arena, std::pmr arguments converted in it use
+/// the default resource. Used for arguments that may outlive the call,
+/// like the constructor ones, or nested in an outer call arena.
+class no_call_arena
+{
+public:
+	no_call_arena()
+		: prev_(std::exchange(call_arena::current(), nullptr))
+	{
+	}
+
+	~no_call_arena()
+	{
+		call_arena::current() = prev_;
+	}
+
+	no_call_arena(no_call_arena const&) = delete;
+	no_call_arena& operator=(no_call_arena const&) = delete;
+
+private:
+	call_arena* prev_;
+};
+
+// Callable with std::pmr arguments allocated in a call arena, see v8pp::with_call_arena()
+template<typename F>
+struct call_arena_function
+{
+	using function_type = F;
+	F func;
+};
+
+template<typename F>
+struct is_call_arena_function : std::false_type
+{
+};
+
+template<typename F>
+struct is_call_arena_function<call_arena_function<F>> : std::true_type
+{
+};
+
+// The callable to invoke: F itself or the one in call_arena_function<F>
+template<typename F>
+struct call_target
+{
+	using type = F;
+	static F& get(F& func) { return func; }
+	static F const& get(F const& func) { return func; }
+};
+
+template<typename F>
+struct call_target<call_arena_function<F>>
+{
+	using type = F;
+	static F& get(call_arena_function<F>& func) { return func.func; }
+	static F const& get(call_arena_function<F> const& func) { return func.func; }
+};
+
+template<typename F>
+using call_target_t = typename call_target<F>::type;
+
+template<typename F>
+struct function_traits<call_arena_function<F>> : function_traits<F>
+{
+};
+
+template<typename F>
+struct is_callable_impl<call_arena_function<F>, true>
+{
+	static constexpr bool value = is_callable<F>::value || std::is_member_function_pointer_v<F>;
+};
+
 template<typename F, size_t Offset = 0>
 struct call_from_v8_traits
 {
@@ -54,11 +184,27 @@ struct call_from_v8_traits
 			typename Traits::template convert_ref<U>>,
 		convert<std::remove_cv_t<T>>>;
 
+	// Is the current context needed to convert any of the arguments
+	template<typename Traits, size_t... Indices>
+	static constexpr bool uses_context(std::index_sequence<Indices...>)
+	{
+		return (context_from_v8<arg_converter<arg_type<Indices + offset>, Traits>> || ...);
+	}
+
 	template<size_t Index, typename Traits>
-	static decltype(auto) arg_from_v8(v8::FunctionCallbackInfo<v8::Value> const& args)
+	static decltype(auto) arg_from_v8(v8::FunctionCallbackInfo<v8::Value> const& args, v8::Local<v8::Context> context)
 	{
-		// might be reference
-		return (arg_converter<arg_type<Index>, Traits>::from_v8(args.GetIsolate(), args[Index - offset]));
+		if constexpr (is_pmr_container<std::remove_cvref_t<arg_type<Index>>>::value)
+		{
+			// allocate in the call arena, only while converting the argument
+			conversion_resource_scope scope(call_arena::current_resource());
+			return from_v8_in<arg_converter<arg_type<Index>, Traits>>(args.GetIsolate(), context, args[Index - offset]);
+		}
+		else
+		{
+			// might be reference
+			return (from_v8_in<arg_converter<arg_type<Index>, Traits>>(args.GetIsolate(), context, args[Index - offset]));
+		}
 	}
 };
 
@@ -75,8 +221,14 @@ decltype(auto) call_from_v8_impl(F&& func, v8::FunctionCallbackInfo<v8::Value> c
 	CallTraits, std::index_sequence<Indices...>, ObjArg&&... obj)
 {
 	(void)args;
+	// get the current context once for all arguments, only when a converter uses it
+	v8::Local<v8::Context> context;
+	if constexpr (CallTraits::template uses_context<Traits>(std::index_sequence<Indices...>{}))
+	{
+		context = args.GetIsolate()->GetCurrentContext();
+	}
 	return (std::invoke(func, std::forward<ObjArg>(obj)...,
-		CallTraits::template arg_from_v8<Indices + CallTraits::offset, Traits>(args)...));
+		CallTraits::template arg_from_v8<Indices + CallTraits::offset, Traits>(args, context)...));
 }
 
 template<typename Traits, typename F, typename... ObjArg>
@@ -122,3 +274,16 @@ decltype(auto) call_from_v8(F&& func, v8::FunctionCallbackInfo<v8::Value> const&
 }
 
 } // namespace v8pp::detail
+
+namespace v8pp {
+
+/// Wrap `func` to allocate its std::pmr container arguments in a per-call
+/// arena, released when the call returns. The function must not keep
+/// such arguments, or anything allocated with their allocators, after the call.
+template<typename F>
+detail::call_arena_function<std::decay_t<F>> with_call_arena(F&& func)
+{
+	return { std::forward<F>(func) };
+}
+
+} // namespace v8pp
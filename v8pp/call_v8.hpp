@@ -2,18 +2,28 @@
 
 #include <v8.h>
 
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+
 #include "v8pp/convert.hpp"
+#include "v8pp/throw_ex.hpp"
 
 namespace v8pp {
 
-/// Call a V8 function, converting C++ arguments to v8::Value arguments
+/// Call a V8 function in a context, converting C++ arguments to v8::Value arguments
 /// @param isolate V8 isolate instance
+/// @param context V8 context to convert arguments and call the function in
 /// @param func  V8 function to call
 /// @param recv V8 object used as `this` in the function
 /// @param args...  C++ arguments to convert to JS arguments using to_v8
-template<typename... Args>
-v8::Local<v8::Value> call_v8(v8::Isolate* isolate, v8::Local<v8::Function> func,
-	v8::Local<v8::Value> recv, Args&&... args)
+// Context and Recv are deduced to not compete with the overload below
+template<typename Context, typename Recv, typename... Args>
+	requires std::same_as<Context, v8::Context> && std::derived_from<Recv, v8::Value>
+v8::Local<v8::Value> call_v8(v8::Isolate* isolate, v8::Local<Context> context,
+	v8::Local<v8::Function> func, v8::Local<Recv> recv, Args&&... args)
 {
 	v8::EscapableHandleScope scope(isolate);
 
@@ -21,14 +31,391 @@ v8::Local<v8::Value> call_v8(v8::Isolate* isolate, v8::Local<v8::Function> func,
 	// +1 to allocate array for arg_count == 0
 	v8::Local<v8::Value> v8_args[arg_count + 1] =
 	{
-		to_v8(isolate, std::forward<Args>(args))...
+		detail::to_v8_value(isolate, context, std::forward<Args>(args))...
 	};
 
 	v8::Local<v8::Value> result;
-	bool const is_empty_result = func->Call(isolate->GetCurrentContext(), recv, arg_count, v8_args).ToLocal(&result);
+	bool const is_empty_result = func->Call(context, recv, arg_count, v8_args).ToLocal(&result);
 	(void)is_empty_result;
 
 	return scope.Escape(result);
 }
 
+/// Call a V8 function, converting C++ arguments to v8::Value arguments
+/// @param isolate V8 isolate instance
+/// @param func  V8 function to call
+/// @param recv V8 object used as `this` in the function
+/// @param args...  C++ arguments to convert to JS arguments using to_v8
+template<typename... Args>
+v8::Local<v8::Value> call_v8(v8::Isolate* isolate, v8::Local<v8::Function> func,
+	v8::Local<v8::Value> recv, Args&&... args)
+{
+	return call_v8(isolate, isolate->GetCurrentContext(), func, recv, std::forward<Args>(args)...);
+}
+
+/// Call a method of V8 object by name in a context, converting C++ arguments to v8::Value arguments
+/// Method name is converted to an internalized V8 string once per isolate.
+/// @param isolate V8 isolate instance
+/// @param context V8 context to get the method and call it in
+/// @param obj V8 object used as `this` in the method
+/// @param name method name
+/// @param args...  C++ arguments to convert to JS arguments using to_v8
+/// @return method call result, or empty handle on exception
+///   or when the property is not a function, with TypeError thrown
+template<typename Context, typename Object, typename... Args>
+	requires std::same_as<Context, v8::Context> && std::derived_from<Object, v8::Object>
+v8::Local<v8::Value> call_method(v8::Isolate* isolate, v8::Local<Context> context,
+	v8::Local<Object> obj, std::string_view name, Args&&... args)
+{
+	v8::EscapableHandleScope scope(isolate);
+
+	v8::Local<v8::String> key = detail::string_table::instance(isolate).key(isolate, name)->handle.Get(isolate);
+	v8::Local<v8::Value> method;
+	if (!obj->Get(context, key).ToLocal(&method))
+	{
+		return {};
+	}
+	if (!method->IsFunction())
+	{
+		throw_type_error(isolate, std::string(name) + " is not a function");
+		return {};
+	}
+	return scope.Escape(call_v8(isolate, context, method.As<v8::Function>(), obj, std::forward<Args>(args)...));
+}
+
+/// Call a method of V8 object by name in the current context
+/// @param isolate V8 isolate instance
+/// @param obj V8 object used as `this` in the method
+/// @param name method name
+/// @param args...  C++ arguments to convert to JS arguments using to_v8
+template<typename... Args>
+v8::Local<v8::Value> call_method(v8::Isolate* isolate, v8::Local<v8::Object> obj,
+	std::string_view name, Args&&... args)
+{
+	return call_method(isolate, isolate->GetCurrentContext(), obj, name, std::forward<Args>(args)...);
+}
+
+/// Method of a V8 object resolved once and cached for repeated calls.
+/// Calls skip the property lookup, so a reassigned method is not noticed.
+/// Call `refresh()` after the object method may have been changed.
+class bound_method
+{
+public:
+	/// Resolve method `name` of `obj` in the current context
+	bound_method(v8::Isolate* isolate, v8::Local<v8::Object> obj, std::string_view name)
+		: isolate_(isolate)
+		, key_(detail::string_table::instance(isolate).key(isolate, name))
+		, obj_(isolate, obj)
+	{
+		v8::HandleScope scope(isolate_);
+		func_.Reset(isolate_, lookup(isolate_->GetCurrentContext()));
+	}
+
+	v8::Isolate* isolate() const { return isolate_; }
+	v8::Local<v8::Object> receiver() const { return obj_.Get(isolate_); }
+	v8::Local<v8::Function> function() const { return func_.Get(isolate_); }
+
+	/// Is the method resolved to a function
+	bool is_valid() const { return !func_.IsEmpty(); }
+	explicit operator bool() const { return is_valid(); }
+
+	/// Resolve the method again with a property lookup,
+	/// return true if it has been changed
+	bool refresh()
+	{
+		v8::HandleScope scope(isolate_);
+		v8::Local<v8::Function> func = lookup(isolate_->GetCurrentContext());
+		if (func == func_.Get(isolate_))
+		{
+			return false;
+		}
+		func_.Reset(isolate_, func);
+		return true;
+	}
+
+	/// Call the cached method in the current context
+	/// @return method call result, or empty handle on exception
+	///   or when the method is not resolved, with TypeError thrown
+	template<typename... Args>
+	v8::Local<v8::Value> operator()(Args&&... args) const
+	{
+		if (func_.IsEmpty())
+		{
+			throw_type_error(isolate_, key_->value + " is not a function");
+			return {};
+		}
+		v8::EscapableHandleScope scope(isolate_);
+		return scope.Escape(call_v8(isolate_, isolate_->GetCurrentContext(), func_.Get(isolate_), obj_.Get(isolate_),
+			std::forward<Args>(args)...));
+	}
+
+private:
+	v8::Local<v8::Function> lookup(v8::Local<v8::Context> context) const
+	{
+		v8::Local<v8::Value> method;
+		if (obj_.Get(isolate_)->Get(context, key_->handle.Get(isolate_)).ToLocal(&method) && method->IsFunction())
+		{
+			return method.As<v8::Function>();
+		}
+		return {};
+	}
+
+	v8::Isolate* isolate_;
+	std::shared_ptr<detail::string_atom const> key_;
+	v8::Global<v8::Object> obj_;
+	v8::Global<v8::Function> func_;
+};
+
+namespace detail {
+
+template<typename T>
+struct is_local : std::false_type
+{
+};
+
+template<typename T>
+struct is_local<v8::Local<T>> : std::true_type
+{
+};
+
+} // namespace detail
+
+/// Error of a failed prepared call, the exception message
+struct call_error
+{
+	std::string message;
+};
+
+/// Result of a prepared call: either a converted value or an error
+template<typename R>
+class call_result
+{
+public:
+	using value_type = R;
+
+	call_result(R value) : value_(std::move(value)) {}
+	call_result(call_error error) : error_(std::move(error.message)) {}
+
+	bool has_value() const { return value_.has_value(); }
+	explicit operator bool() const { return has_value(); }
+
+	/// Converted result, throws std::runtime_error with the error message on failure
+	R& value() &
+	{
+		check();
+		return *value_;
+	}
+
+	R const& value() const&
+	{
+		check();
+		return *value_;
+	}
+
+	R&& value() &&
+	{
+		check();
+		return std::move(*value_);
+	}
+
+	template<typename U>
+	R value_or(U&& default_value) const&
+	{
+		return value_ ? *value_ : static_cast<R>(std::forward<U>(default_value));
+	}
+
+	R& operator*() { return *value_; }
+	R const& operator*() const { return *value_; }
+	R* operator->() { return &*value_; }
+	R const* operator->() const { return &*value_; }
+
+	/// Error message, empty on success
+	std::string const& error() const { return error_; }
+
+private:
+	void check() const
+	{
+		if (!value_)
+		{
+			throw std::runtime_error(error_);
+		}
+	}
+
+	std::optional<R> value_;
+	std::string error_;
+};
+
+template<>
+class call_result<void>
+{
+public:
+	using value_type = void;
+
+	call_result() = default;
+	call_result(call_error error) : failed_(true), error_(std::move(error.message)) {}
+
+	bool has_value() const { return !failed_; }
+	explicit operator bool() const { return has_value(); }
+
+	/// Throws std::runtime_error with the error message on failure
+	void value() const
+	{
+		if (failed_)
+		{
+			throw std::runtime_error(error_);
+		}
+	}
+
+	/// Error message, empty on success
+	std::string const& error() const { return error_; }
+
+private:
+	bool failed_ = false;
+	std::string error_;
+};
+
+template<typename Signature>
+class prepared_call;
+
+/// V8 function and receiver prepared for repeated calls with fixed C++ signature
+/// Arguments are converted with to_v8, the result with from_v8<R>.
+/// JavaScript exceptions and result conversion errors are returned in call_result<R>.
+template<typename R, typename... Args>
+class prepared_call<R(Args...)>
+{
+public:
+	using result_type = call_result<R>;
+
+	/// Prepare a function call with `recv` as `this`, undefined by default
+	prepared_call(v8::Isolate* isolate, v8::Local<v8::Function> func,
+		v8::Local<v8::Value> recv = {})
+		: isolate_(isolate)
+		, func_(isolate, func)
+		, recv_(isolate, receiver_or_undefined(isolate, recv))
+	{
+	}
+
+	prepared_call(prepared_call const&) = delete;
+	prepared_call& operator=(prepared_call const&) = delete;
+
+	prepared_call(prepared_call&&) = default;
+	prepared_call& operator=(prepared_call&&) = default;
+
+	v8::Isolate* isolate() const { return isolate_; }
+	v8::Local<v8::Function> function() const { return func_.Get(isolate_); }
+	v8::Local<v8::Value> receiver() const { return recv_.Get(isolate_); }
+
+	/// Call the function in the current context
+	result_type operator()(Args... args) const
+	{
+		v8::EscapableHandleScope scope(isolate_);
+		v8::Local<v8::Context> context = isolate_->GetCurrentContext();
+		v8::TryCatch try_catch(isolate_);
+
+		result_type result = invoke(context, func_.Get(isolate_), recv_.Get(isolate_),
+			try_catch, std::forward<Args>(args)...);
+		if constexpr (detail::is_local<R>::value)
+		{
+			if (result)
+			{
+				return result_type(scope.Escape(*result));
+			}
+		}
+		return result;
+	}
+
+	/// Call the function for each element of `range` in the current context,
+	/// write call results to `out`. Range elements are tuples of arguments,
+	/// or single arguments for a one argument signature.
+	/// The context, receiver and exception handler are set up once for the batch.
+	template<typename Range, typename OutputIterator>
+	OutputIterator call_each(Range&& range, OutputIterator out) const
+	{
+		static_assert(!detail::is_local<R>::value, "batch results can not be V8 handles");
+
+		v8::HandleScope scope(isolate_);
+		v8::Local<v8::Context> context = isolate_->GetCurrentContext();
+		v8::Local<v8::Function> func = func_.Get(isolate_);
+		v8::Local<v8::Value> recv = recv_.Get(isolate_);
+		v8::TryCatch try_catch(isolate_);
+
+		for (auto&& args : range)
+		{
+			v8::HandleScope element_scope(isolate_);
+			if constexpr (detail::is_tuple<std::decay_t<decltype(args)>>::value)
+			{
+				*out = std::apply([&](auto&&... elements)
+					{
+						return invoke(context, func, recv, try_catch, std::forward<decltype(elements)>(elements)...);
+					}, std::forward<decltype(args)>(args));
+			}
+			else
+			{
+				static_assert(sizeof...(Args) == 1, "range elements must be argument tuples");
+				*out = invoke(context, func, recv, try_catch, std::forward<decltype(args)>(args));
+			}
+			++out;
+			if (try_catch.HasTerminated())
+			{
+				break;
+			}
+		}
+		return out;
+	}
+
+private:
+	static v8::Local<v8::Value> receiver_or_undefined(v8::Isolate* isolate, v8::Local<v8::Value> recv)
+	{
+		if (recv.IsEmpty())
+		{
+			return v8::Undefined(isolate);
+		}
+		return recv;
+	}
+
+	template<typename... CallArgs>
+	result_type invoke(v8::Local<v8::Context> context, v8::Local<v8::Function> func,
+		v8::Local<v8::Value> recv, v8::TryCatch& try_catch, CallArgs&&... args) const
+	{
+		static_assert(sizeof...(CallArgs) == sizeof...(Args), "wrong number of arguments");
+
+		try
+		{
+			int const arg_count = sizeof...(CallArgs);
+			// +1 to allocate array for arg_count == 0
+			v8::Local<v8::Value> v8_args[arg_count + 1] =
+			{
+				detail::to_v8_value(isolate_, context, std::forward<CallArgs>(args))...
+			};
+
+			v8::Local<v8::Value> result;
+			if (!func->Call(context, recv, arg_count, v8_args).ToLocal(&result))
+			{
+				call_error error{ exception_message(isolate_, try_catch) };
+				if (!try_catch.HasTerminated())
+				{
+					try_catch.Reset();
+				}
+				return error;
+			}
+			if constexpr (std::is_void_v<R>)
+			{
+				return result_type();
+			}
+			else
+			{
+				return result_type(v8pp::from_v8<R>(isolate_, context, result));
+			}
+		}
+		catch (std::exception const& ex)
+		{
+			return call_error{ ex.what() };
+		}
+	}
+
+	v8::Isolate* isolate_;
+	v8::Global<v8::Function> func_;
+	v8::Global<v8::Value> recv_;
+};
+
 } // namespace v8pp
@@ -33,6 +33,34 @@ template
 object_registry<shared_ptr_traits>& classes::find<shared_ptr_traits>(v8::Isolate* isolate,
 	type_info const& type);
 
+template
+class object_registry<unique_ptr_traits>;
+
+template
+object_registry<unique_ptr_traits>& classes::add<unique_ptr_traits>(v8::Isolate* isolate,
+	type_info const& type, object_registry<unique_ptr_traits>::dtor_function&& dtor);
+
+template
+void classes::remove<unique_ptr_traits>(v8::Isolate* isolate, type_info const& type);
+
+template
+object_registry<unique_ptr_traits>& classes::find<unique_ptr_traits>(v8::Isolate* isolate,
+	type_info const& type);
+
+template
+class object_registry<intrusive_ptr_traits>;
+
+template
+object_registry<intrusive_ptr_traits>& classes::add<intrusive_ptr_traits>(v8::Isolate* isolate,
+	type_info const& type, object_registry<intrusive_ptr_traits>::dtor_function&& dtor);
+
+template
+void classes::remove<intrusive_ptr_traits>(v8::Isolate* isolate, type_info const& type);
+
+template
+object_registry<intrusive_ptr_traits>& classes::find<intrusive_ptr_traits>(v8::Isolate* isolate,
+	type_info const& type);
+
 } // namespace v8pp::detail
 
 #endif
@@ -1,7 +1,14 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -16,6 +23,20 @@
 #include <v8-external-memory-accounter.h>
 #endif
 
+namespace v8pp {
+
+/// Statistics of wrapped objects removal after V8 garbage collection
+struct sweep_stats
+{
+	size_t sweeps = 0;      // number of sweeps
+	size_t objects = 0;     // total number of removed objects
+	size_t max_objects = 0; // maximal number of objects removed in a sweep
+	std::chrono::nanoseconds duration{};     // total duration of sweeps
+	std::chrono::nanoseconds max_duration{}; // maximal duration of a sweep
+};
+
+} // namespace v8pp
+
 namespace v8pp::detail {
 
 struct class_info
@@ -30,6 +51,46 @@ struct class_info
 	std::string class_name() const;
 };
 
+/// A single background thread to destroy wrapped C++ objects collected by V8 GC,
+/// tasks are run one by one in order of posting
+class destroy_queue
+{
+public:
+	static destroy_queue& instance();
+
+	/// Number of enqueued and running tasks of one poster, guarded by the queue
+	struct pending_tasks
+	{
+		size_t count = 0;
+	};
+
+	/// Enqueue a destroy task, never blocks on the task execution
+	void post(std::function<void ()>&& task, pending_tasks& pending);
+
+	/// Wait until all enqueued tasks have been completed
+	void wait();
+
+	/// Wait until enqueued tasks of one poster have been completed
+	void wait(pending_tasks const& pending);
+
+	destroy_queue(destroy_queue const&) = delete;
+	destroy_queue& operator=(destroy_queue const&) = delete;
+
+private:
+	destroy_queue() = default;
+	~destroy_queue();
+
+	void run();
+
+	std::mutex mutex_;
+	std::condition_variable task_posted_;
+	std::condition_variable tasks_done_;
+	std::deque<std::pair<std::function<void ()>, pending_tasks*>> tasks_;
+	size_t running_ = 0;
+	bool stop_ = false;
+	std::thread thread_;
+};
+
 template<typename Traits>
 class object_registry final : public class_info
 {
@@ -56,17 +117,47 @@ public:
 
 	v8::Local<v8::FunctionTemplate> class_function_template()
 	{
+		if (func_.IsEmpty()) create_templates();
 		return to_local(isolate_, func_);
 	}
 
 	v8::Local<v8::FunctionTemplate> js_function_template()
 	{
+		if (js_func_.IsEmpty()) create_templates();
 		return to_local(isolate_, js_func_);
 	}
 
+	/// Have the class function templates been created
+	bool has_templates() const { return !func_.IsEmpty(); }
+
+	/// Apply a binding function `void(object_registry&)` to the class templates,
+	/// deferred until the templates are created on first use
+	template<typename Binding>
+	void bind(Binding&& binding)
+	{
+		if (has_templates())
+		{
+			v8::HandleScope scope(isolate_);
+			binding(*this);
+		}
+		else
+		{
+			bindings_.emplace_back(new deferred_binding<std::decay_t<Binding>>(std::forward<Binding>(binding)));
+		}
+	}
+
 	void set_auto_wrap_objects(bool auto_wrap) { auto_wrap_objects_ = auto_wrap; }
 	bool auto_wrap_objects() const { return auto_wrap_objects_; }
 
+	void set_share_functions(bool share) { share_functions_ = share; }
+	bool share_functions() const { return share_functions_; }
+
+	void set_destroy_in_background(bool in_background) { destroy_in_background_ = in_background; }
+	bool destroy_in_background() const { return destroy_in_background_; }
+
+	void set_identity_tracking(bool tracking);
+	bool identity_tracking() const { return identity_tracking_; }
+
 	void set_ctor(ctor_function&& ctor) { ctor_ = std::move(ctor); }
 
 	void add_base(object_registry& info, cast_function cast);
@@ -75,12 +166,24 @@ public:
 	void remove_object(object_id const& obj);
 	void remove_objects();
 
+	/// Remove and destroy objects collected by GC
+	void sweep_objects();
+	v8pp::sweep_stats const& sweep_stats() const { return sweep_stats_; }
+
 	pointer_type find_object(object_id id, type_info const& actual_type) const;
 	v8::Local<v8::Object> find_v8_object(pointer_type const& ptr) const;
 
 	v8::Local<v8::Object> wrap_object(pointer_type const& object, size_t size);
 	v8::Local<v8::Object> wrap_object(v8::FunctionCallbackInfo<v8::Value> const& args);
 	pointer_type unwrap_object(v8::Local<v8::Value> value);
+	pointer_type release_object(v8::Local<v8::Value> value);
+
+	/// Unwrap an object with its own wrapped C++ object, without the prototype chain walk
+	pointer_type unwrap_own_object(v8::Local<v8::Object> obj) const;
+
+	/// Wrap an object referenced until release_borrowed_object(), see v8pp::borrowed
+	v8::Local<v8::Object> wrap_borrowed_object(pointer_type const& object);
+	void release_borrowed_object(v8::Local<v8::Object> obj);
 
 private:
 	struct wrapped_object
@@ -89,8 +192,87 @@ private:
 		size_t size; // 0 for referenced objects
 	};
 
+	using objects_map = std::unordered_map<pointer_type, wrapped_object>;
+
+	// object wrapped without identity tracking, owned by its JavaScript object
+	struct untracked_object
+	{
+		pointer_type object;
+		wrapped_object wrapped;
+		untracked_object* prev;
+		untracked_object* next;
+	};
+
+	struct binding_base
+	{
+		virtual ~binding_base() = default;
+		virtual void apply(object_registry& registry) = 0;
+	};
+
+	template<typename Binding>
+	struct deferred_binding final : binding_base
+	{
+		Binding binding;
+
+		template<typename B>
+		explicit deferred_binding(B&& binding)
+			: binding(std::forward<B>(binding))
+		{
+		}
+
+		void apply(object_registry& registry) override { binding(registry); }
+	};
+
+	void create_templates();
+
 	void reset_object(pointer_type const& object, wrapped_object& wrapped);
 
+	// Is the object id a slot of borrowed_objects_
+	bool is_borrowed(object_id id) const
+	{
+		auto const slot = static_cast<pointer_type const*>(id);
+		return std::less_equal<>{}(borrowed_objects_.data(), slot)
+			&& std::less<>{}(slot, borrowed_objects_.data() + borrowed_objects_.size());
+	}
+
+public:
+	/// C++ object of this class wrapped in the JavaScript object, read from
+	/// its internal fields without lookup. nullptr for objects of other classes,
+	/// including derived ones
+	void* object_pointer(v8::Local<v8::Object> obj) const
+	{
+		if (obj->InternalFieldCount() != 2 || obj->GetAlignedPointerFromInternalField(1) != this)
+		{
+			return nullptr;
+		}
+		object_id id = obj->GetAlignedPointerFromInternalField(0);
+		if (!id)
+		{
+			return nullptr;
+		}
+		if (is_borrowed(id))
+		{
+			pointer_type const& ptr = *static_cast<pointer_type const*>(id);
+			return ptr ? Traits::pointer_id(ptr) : nullptr;
+		}
+		if (!identity_tracking_)
+		{
+			return Traits::pointer_id(static_cast<untracked_object*>(id)->object);
+		}
+		return id;
+	}
+
+private:
+	pointer_type find_untracked_object(untracked_object* node, type_info const& actual_type) const;
+	pointer_type find_wrapped_object(object_id id, type_info const& actual_type) const;
+	void unlink_untracked_object(untracked_object* node);
+
+	static void object_collected(v8::WeakCallbackInfo<typename objects_map::value_type> const& data);
+	static void objects_collected(v8::WeakCallbackInfo<typename objects_map::value_type> const& data);
+
+	static void untracked_object_collected(v8::WeakCallbackInfo<untracked_object> const& data);
+	static void untracked_objects_collected(v8::WeakCallbackInfo<untracked_object> const& data);
+
 	struct base_class_info
 	{
 		object_registry& info;
@@ -105,11 +287,17 @@ private:
 
 	std::vector<base_class_info> bases_;
 	std::vector<object_registry*> derivatives_;
-	std::unordered_map<pointer_type, wrapped_object> objects_;
+	objects_map objects_;
+	std::vector<object_id> dead_objects_; // collected by GC, but not removed yet
+	untracked_object* untracked_objects_; // list of alive untracked objects
+	std::vector<untracked_object*> dead_untracked_objects_;
+	std::array<pointer_type, 32> borrowed_objects_; // referenced during calls, null for free slots
+	v8pp::sweep_stats sweep_stats_;
 
 	v8::Isolate* isolate_;
 	v8::Global<v8::FunctionTemplate> func_;
 	v8::Global<v8::FunctionTemplate> js_func_;
+	std::vector<std::unique_ptr<binding_base>> bindings_; // applied on the templates creation
 
 #if V8_MAJOR_VERSION > 13 || (V8_MAJOR_VERSION == 13 && V8_MINOR_VERSION >= 3)
 	v8::ExternalMemoryAccounter external_memory_accounter_;
@@ -137,6 +325,11 @@ private:
 	ctor_function ctor_;
 	dtor_function dtor_;
 	bool auto_wrap_objects_;
+	bool share_functions_;
+	bool destroy_in_background_;
+	bool destroy_tasks_posted_; // to wait for them on destruction
+	destroy_queue::pending_tasks destroy_tasks_;
+	bool identity_tracking_;
 };
 
 class classes
@@ -154,6 +347,9 @@ public:
 
 	static void remove_all(v8::Isolate* isolate);
 
+	static bool contains(v8::Isolate* isolate, class_info const* info);
+	static bool contains(v8::Isolate* isolate, type_info const& type);
+
 private:
 	using classes_info = std::vector<std::unique_ptr<class_info>>;
 	classes_info classes_;
@@ -260,7 +456,11 @@ public:
 			return pointer_type{Traits::template static_pointer_cast<U>(
 				Traits::template static_pointer_cast<T>(ptr))};
 		});
-		class_info_.js_function_template()->Inherit(base.class_function_template());
+		class_info_.bind([](object_registry& info)
+		{
+			auto& base = detail::classes::find<Traits>(info.isolate(), detail::type_id<U>());
+			info.js_function_template()->Inherit(base.class_function_template());
+		});
 		return *this;
 	}
 
@@ -271,32 +471,69 @@ public:
 		return *this;
 	}
 
+	/// Share function templates of functions bound after this call with other
+	/// classes and modules with the same setting, see module::share_functions()
+	class_& share_functions(bool share = true)
+	{
+		class_info_.set_share_functions(share);
+		return *this;
+	}
+
+	/// Destroy wrapped C++ objects in a background thread to reduce GC pauses.
+	/// The destroy function must be thread-safe and must not use V8 API.
+	class_& destroy_in_background(bool in_background = true)
+	{
+		class_info_.set_destroy_in_background(in_background);
+		return *this;
+	}
+
+	/// Disable identity tracking for immutable value classes: wrapped objects
+	/// are not registered, each wrapping creates a new JavaScript object
+	/// which owns the C++ object until garbage collection.
+	/// Must be set before any object of the class has been wrapped.
+	class_& identity_tracking(bool tracking)
+	{
+		static_assert(!std::same_as<Traits, intrusive_ptr_traits>,
+			"reference counted objects require identity tracking");
+		class_info_.set_identity_tracking(tracking);
+		return *this;
+	}
+
 	/// Set class member function, or static function, or lambda
 	template<typename Function>
 	class_& function(std::string_view name, Function&& func, v8::PropertyAttribute attr = v8::None)
 	{
-		constexpr bool is_mem_fun = std::is_member_function_pointer_v<Function>;
+		using Target = detail::call_target_t<std::decay_t<Function>>;
+		constexpr bool is_mem_fun = std::is_member_function_pointer_v<Target>;
 
 		static_assert(is_mem_fun || detail::is_callable<Function>::value,
 			"Function must be pointer to member function or callable object");
 
-		v8::HandleScope scope(isolate());
-
-		v8::Local<v8::Name> v8_name = v8pp::to_v8(isolate(), name);
-		v8::Local<v8::Data> wrapped_fun;
-
 		if constexpr (is_mem_fun)
 		{
-			using mem_func_type = typename detail::function_traits<Function>::template pointer_type<T>;
-			wrapped_fun = wrap_function_template<mem_func_type, Traits>(isolate(), mem_func_type(std::forward<Function>(func)));
+			using mem_func_type = typename detail::function_traits<Target>::template pointer_type<T>;
+			using bound_type = std::conditional_t<detail::is_call_arena_function<std::decay_t<Function>>::value,
+				detail::call_arena_function<mem_func_type>, mem_func_type>;
+			bound_type bound{ mem_func_type(detail::call_target<std::decay_t<Function>>::get(func)) };
+			class_info_.bind([name = std::string(name), func = bound, attr, share = class_info_.share_functions()](object_registry& info)
+			{
+				v8::Local<v8::Name> v8_name = v8pp::to_v8(info.isolate(), name);
+				v8::Local<v8::Data> wrapped_fun = detail::shared_function_template<bound_type, Traits>(info.isolate(), bound_type(func), share);
+				info.class_function_template()->PrototypeTemplate()->Set(v8_name, wrapped_fun, attr);
+			});
 		}
 		else
 		{
-			wrapped_fun = wrap_function_template<Function, Traits>(isolate(), std::forward<Function>(func));
-			class_info_.js_function_template()->Set(v8_name, wrapped_fun, attr);
+			using Fun = typename std::decay_t<Function>;
+			class_info_.bind([name = std::string(name), func = Fun(std::forward<Function>(func)), attr,
+				share = class_info_.share_functions()](object_registry& info) mutable
+			{
+				v8::Local<v8::Name> v8_name = v8pp::to_v8(info.isolate(), name);
+				v8::Local<v8::Data> wrapped_fun = detail::shared_function_template<Fun, Traits>(info.isolate(), std::move(func), share);
+				info.js_function_template()->Set(v8_name, wrapped_fun, attr);
+				info.class_function_template()->PrototypeTemplate()->Set(v8_name, wrapped_fun, attr);
+			});
 		}
-
-		class_info_.class_function_template()->PrototypeTemplate()->Set(v8_name, wrapped_fun, attr);
 		return *this;
 	}
 
@@ -306,16 +543,47 @@ public:
 	{
 		static_assert(std::is_member_object_pointer_v<Attribute>, "Attribute must be pointer to member data");
 
-		v8::HandleScope scope(isolate());
-
 		using attribute_type = typename detail::function_traits<Attribute>::template pointer_type<T>;
-		attribute_type attr = attribute;
 
-		v8::Local<v8::Name> v8_name = v8pp::to_v8(isolate(), name);
-		v8::AccessorNameGetterCallback getter = &member_get<attribute_type>;
-		v8::AccessorNameSetterCallback setter = &member_set<attribute_type>;
-		v8::Local<v8::Value> data = detail::external_data::set(isolate(), std::forward<attribute_type>(attr));
-		class_info_.class_function_template()->PrototypeTemplate()->SetNativeDataProperty(v8_name, getter, setter, data, v8::PropertyAttribute::DontDelete);
+		class_info_.bind([name = std::string(name), attr = attribute_type(attribute)](object_registry& info)
+		{
+			v8::Local<v8::Name> v8_name = v8pp::to_v8(info.isolate(), name);
+			v8::AccessorNameGetterCallback getter = &member_get<attribute_type>;
+			v8::AccessorNameSetterCallback setter = &member_set<attribute_type>;
+			v8::Local<v8::Value> data = detail::external_data::set(info.isolate(), attribute_type(attr));
+			info.class_function_template()->PrototypeTemplate()->SetNativeDataProperty(v8_name, getter, setter, data, v8::PropertyAttribute::DontDelete);
+		});
+		return *this;
+	}
+
+	/// Set class member variable of arithmetic or bool type with direct access,
+	/// the member pointer is a compile-time constant: `var<&T::x>("x")`
+	template<auto Member>
+	class_& var(std::string_view name)
+	{
+		static_assert(std::is_member_object_pointer_v<decltype(Member)>, "Member must be pointer to member data");
+
+		using attribute_type = std::remove_reference_t<decltype(std::declval<T&>().*Member)>;
+		static_assert(std::is_arithmetic_v<attribute_type>, "Member must be of arithmetic or bool type");
+
+		class_info_.bind([name = std::string(name)](object_registry& info)
+		{
+			v8::Isolate* isolate = info.isolate();
+			v8::Local<v8::FunctionTemplate> class_func = info.class_function_template();
+			v8::Local<v8::Value> data = detail::external_data::set(isolate, &info);
+			// accessor property on the prototype, unlike a native data property its setter
+			// is called on assignment to an instance. V8 checks the instance with the signature
+			v8::Local<v8::Signature> signature = v8::Signature::New(isolate, class_func);
+			v8::Local<v8::FunctionTemplate> getter = v8::FunctionTemplate::New(isolate, &member_get_direct<Member>,
+				data, signature, 0, v8::ConstructorBehavior::kThrow, v8::SideEffectType::kHasNoSideEffect);
+			v8::Local<v8::FunctionTemplate> setter;
+			if constexpr (!std::is_const_v<attribute_type>)
+			{
+				setter = v8::FunctionTemplate::New(isolate, &member_set_direct<Member>,
+					data, signature, 1, v8::ConstructorBehavior::kThrow);
+			}
+			class_func->PrototypeTemplate()->SetAccessorProperty(v8pp::to_v8(isolate, name), getter, setter, v8::PropertyAttribute::DontDelete);
+		});
 		return *this;
 	}
 
@@ -342,13 +610,68 @@ public:
 
 		using property_type = v8pp::property<Getter, Setter, GetClass, SetClass>;
 
-		v8::HandleScope scope(isolate());
+		class_info_.bind([name = std::string(name), property = property_type(std::move(get), std::move(set))](object_registry& info) mutable
+		{
+			v8::AccessorNameGetterCallback getter = property_type::template get<Traits>;
+			v8::AccessorNameSetterCallback setter = property_type::is_readonly ? nullptr : property_type::template set<Traits>;
+			v8::Local<v8::String> v8_name = v8pp::to_v8(info.isolate(), name);
+			v8::Local<v8::Value> data = detail::external_data::set(info.isolate(), std::move(property));
+			info.class_function_template()->PrototypeTemplate()->SetNativeDataProperty(v8_name, getter, setter, data, v8::PropertyAttribute::DontDelete);
+		});
+		return *this;
+	}
+
+	/// Set indexed access `obj[index]` with element get and set functions,
+	/// and a length function for `obj.length`, bounds check and enumeration:
+	/// get(T const&, uint32_t), set(T&, uint32_t, Value), length(T const&)
+	template<typename GetFunction, typename SetFunction, typename LengthFunction>
+	class_& indexer(GetFunction&& get, SetFunction&& set, LengthFunction&& length)
+	{
+		using indexer_type = v8pp::indexer<T, std::decay_t<GetFunction>, std::decay_t<SetFunction>, std::decay_t<LengthFunction>>;
+
+		class_info_.bind([indexer = indexer_type(std::forward<GetFunction>(get), std::forward<SetFunction>(set),
+			std::forward<LengthFunction>(length))](object_registry& info) mutable
+		{
+			decltype(&indexer_type::template get<Traits>) getter = &indexer_type::template get<Traits>;
+			decltype(&indexer_type::template set<Traits>) setter = nullptr;
+			if constexpr (!indexer_type::is_readonly)
+			{
+				setter = &indexer_type::template set<Traits>;
+			}
+			v8::Local<v8::Value> data = detail::external_data::set(info.isolate(), std::move(indexer));
+
+			v8::Local<v8::ObjectTemplate> instance = info.class_function_template()->InstanceTemplate();
+			instance->SetHandler(v8::IndexedPropertyHandlerConfiguration(getter, setter,
+				&indexer_type::template query<Traits>, &indexer_type::template remove<Traits>,
+				&indexer_type::template enumerate<Traits>, data));
+			instance->SetNativeDataProperty(v8pp::to_v8(info.isolate(), "length"), &indexer_type::template get_length<Traits>, nullptr, data,
+				v8::PropertyAttribute(v8::ReadOnly | v8::DontDelete | v8::DontEnum));
+		});
+		return *this;
+	}
+
+	/// Set read-only indexed access `obj[index]`
+	template<typename GetFunction, typename LengthFunction>
+	class_& indexer(GetFunction&& get, LengthFunction&& length)
+	{
+		return indexer(std::forward<GetFunction>(get), detail::none{}, std::forward<LengthFunction>(length));
+	}
 
-		v8::AccessorNameGetterCallback getter = property_type::template get<Traits>;
-		v8::AccessorNameSetterCallback setter = property_type::is_readonly ? nullptr : property_type::template set<Traits>;
-		v8::Local<v8::String> v8_name = v8pp::to_v8(isolate(), name);
-		v8::Local<v8::Value> data = detail::external_data::set(isolate(), property_type(std::move(get), std::move(set)));
-		class_info_.class_function_template()->PrototypeTemplate()->SetNativeDataProperty(v8_name, getter, setter, data, v8::PropertyAttribute::DontDelete);
+	/// Set JavaScript iterator `obj[Symbol.iterator]` for a C++ range class,
+	/// with lazy conversion of range elements. The iterator yields arrays
+	/// of up to chunk_size elements, if it is set.
+	class_& iterable(size_t chunk_size = 0)
+	{
+		static_assert(std::ranges::input_range<T>, "T must be a range");
+
+		class_info_.bind([chunk_size](object_registry& info)
+		{
+			v8::Isolate* isolate = info.isolate();
+			v8::Local<v8::FunctionTemplate> iterator = v8::FunctionTemplate::New(isolate,
+				&iterator_function, detail::external_data::set(isolate, size_t(chunk_size)));
+			info.class_function_template()->PrototypeTemplate()
+				->Set(v8::Symbol::GetIterator(isolate), iterator, v8::DontEnum);
+		});
 		return *this;
 	}
 
@@ -358,9 +681,14 @@ public:
 	{
 		v8::HandleScope scope(isolate());
 
-		class_info_.class_function_template()->PrototypeTemplate()
-			->Set(v8pp::to_v8(isolate(), name), to_v8(isolate(), value),
-				v8::PropertyAttribute(v8::ReadOnly | v8::DontDelete));
+		// convert now, the value may not own its data, like std::string_view
+		v8::Global<v8::Value> v8_value(isolate(), to_v8(isolate(), value));
+		class_info_.bind([name = std::string(name), v8_value = std::move(v8_value)](object_registry& info)
+		{
+			info.class_function_template()->PrototypeTemplate()
+				->Set(v8pp::to_v8(info.isolate(), name), v8_value.Get(info.isolate()),
+					v8::PropertyAttribute(v8::ReadOnly | v8::DontDelete));
+		});
 		return *this;
 	}
 
@@ -390,6 +718,9 @@ public:
 		return class_info_.js_function_template();
 	}
 
+	/// Have the class function templates been created, they are created on first use
+	bool has_templates() const { return class_info_.has_templates(); }
+
 	/// Create JavaScript object which references externally created C++ class.
 	/// It will not take ownership of the C++ pointer.
 	static v8::Local<v8::Object> reference_external(v8::Isolate* isolate, object_pointer_type const& ext)
@@ -418,6 +749,47 @@ public:
 			detail::classes::find<Traits>(isolate, detail::type_id<T>()).unwrap_object(value));
 	}
 
+	/// Get wrapped objects from V8 array elements into `out`, as unwrap_object()
+	/// for each element with a single class lookup. Non-object elements give nullptr.
+	template<typename OutputIterator>
+	static OutputIterator unwrap_objects(v8::Isolate* isolate, v8::Local<v8::Context> context,
+		v8::Local<v8::Array> array, OutputIterator out)
+	{
+		uint32_t const count = array->Length();
+		if (count == 0)
+		{
+			return out;
+		}
+
+		object_registry& class_info = detail::classes::find<Traits>(isolate, detail::type_id<T>());
+
+		v8::HandleScope scope(isolate);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			v8::Local<v8::Value> value = array->Get(context, i).ToLocalChecked();
+			pointer_type ptr = nullptr;
+			if (value->IsObject())
+			{
+				ptr = class_info.unwrap_own_object(value.As<v8::Object>());
+				if (!ptr)
+				{
+					// JavaScript subclass instance
+					ptr = class_info.unwrap_object(value);
+				}
+			}
+			*out++ = Traits::template static_pointer_cast<T>(std::move(ptr));
+		}
+		return out;
+	}
+
+	/// Detach wrapped object owned by V8 value and take its ownership,
+	/// may return nullptr on fail.
+	static object_pointer_type release_object(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return Traits::template static_pointer_cast<T>(
+			detail::classes::find<Traits>(isolate, detail::type_id<T>()).release_object(value));
+	}
+
 	/// Create a wrapped C++ object and import it into JavaScript
 	template<typename... Args>
 	static v8::Local<v8::Object> create_object(v8::Isolate* isolate, Args&&... args)
@@ -426,18 +798,46 @@ public:
 	}
 
 	/// Find V8 object handle for a wrapped C++ object, may return empty handle on fail.
+	/// Without identity tracking always references the obj in a new V8 object.
 	static v8::Local<v8::Object> find_object(v8::Isolate* isolate, object_const_pointer_type const& obj)
 	{
-		return detail::classes::find<Traits>(isolate, detail::type_id<T>()).find_v8_object(Traits::const_pointer_cast(obj));
+		return find_object(detail::classes::find<Traits>(isolate, detail::type_id<T>()), obj);
+	}
+
+	/// Array of V8 object handles for a range of wrapped C++ objects, as find_object()
+	/// for each of them with a single class lookup. Not found objects give null.
+	template<typename Range>
+	static v8::Local<v8::Array> find_objects(v8::Isolate* isolate, v8::Local<v8::Context> context, Range const& objects)
+	{
+		if (std::empty(objects))
+		{
+			return v8::Array::New(isolate);
+		}
+
+		object_registry& class_info = detail::classes::find<Traits>(isolate, detail::type_id<T>());
+
+		v8::EscapableHandleScope scope(isolate);
+		v8::Local<v8::Array> result = v8::Array::New(isolate, static_cast<int>(std::size(objects)));
+		uint32_t index = 0;
+		for (auto const& obj : objects)
+		{
+			v8::Local<v8::Value> wrapped = find_object(class_info, obj);
+			if (wrapped.IsEmpty())
+			{
+				wrapped = v8::Null(isolate);
+			}
+			result->Set(context, index++, wrapped).FromJust();
+		}
+		return scope.Escape(result);
 	}
 
 	/// Find V8 object handle for a wrapped C++ object, may return empty handle on fail
-	/// or wrap a copy of the obj if class_.auto_wrap_objects()
+	/// or wrap a copy of the obj if class_.auto_wrap_objects() or without identity tracking
 	static v8::Local<v8::Object> find_object(v8::Isolate* isolate, T const& obj)
 	{
 		auto& class_info = detail::classes::find<Traits>(isolate, detail::type_id<T>());
 		v8::Local<v8::Object> wrapped_object = class_info.find_v8_object(Traits::key(const_cast<T*>(&obj)));
-		if (wrapped_object.IsEmpty() && class_info.auto_wrap_objects())
+		if (wrapped_object.IsEmpty() && (class_info.auto_wrap_objects() || !class_info.identity_tracking()))
 		{
 			object_pointer_type clone = Traits::clone(obj);
 			if (clone)
@@ -460,6 +860,12 @@ public:
 		detail::classes::find<Traits>(isolate, detail::type_id<T>()).remove_objects();
 	}
 
+	/// Statistics of removal for wrapped C++ objects collected by GC
+	static v8pp::sweep_stats sweep_stats(v8::Isolate* isolate)
+	{
+		return detail::classes::find<Traits>(isolate, detail::type_id<T>()).sweep_stats();
+	}
+
 	/// Destroy all wrapped C++ objects and this binding class_
 	static void destroy(v8::Isolate* isolate)
 	{
@@ -467,6 +873,17 @@ public:
 	}
 
 private:
+	template<typename Pointer>
+	static v8::Local<v8::Object> find_object(object_registry& class_info, Pointer const& obj)
+	{
+		if (!class_info.identity_tracking())
+		{
+			return class_info.wrap_object(Traits::const_pointer_cast(obj), 0);
+		}
+		// find with a non-owning key, without a copy of the obj pointer
+		return class_info.find_v8_object(Traits::key(const_cast<T*>(std::to_address(obj))));
+	}
+
 	template<typename Attribute>
 	static void member_get(v8::Local<v8::Name>,
 		v8::PropertyCallbackInfo<v8::Value> const& info)
@@ -476,8 +893,20 @@ private:
 		try
 		{
 			auto self = unwrap_object(isolate, info.This());
+			if (!self)
+			{
+				throw std::runtime_error("member accessed on null instance");
+			}
 			Attribute attr = detail::external_data::get<Attribute>(info.Data());
-			info.GetReturnValue().Set(to_v8(isolate, (*self).*attr));
+			using attr_type = typename detail::function_traits<Attribute>::return_type;
+			if constexpr (std::is_arithmetic_v<attr_type>)
+			{
+				set_return_value(info.GetReturnValue(), (*self).*attr);
+			}
+			else
+			{
+				info.GetReturnValue().Set(to_v8(isolate, (*self).*attr));
+			}
 		}
 		catch (std::exception const& ex)
 		{
@@ -494,6 +923,10 @@ private:
 		try
 		{
 			auto self = unwrap_object(isolate, info.This());
+			if (!self)
+			{
+				throw std::runtime_error("member accessed on null instance");
+			}
 			Attribute ptr = detail::external_data::get<Attribute>(info.Data());
 			using attr_type = typename detail::function_traits<Attribute>::return_type;
 			(*self).*ptr = v8pp::from_v8<attr_type>(isolate, value);
@@ -507,6 +940,102 @@ private:
 			//TODO: info.GetReturnValue().Set(false);
 		}
 	}
+
+	static void iterator_function(v8::FunctionCallbackInfo<v8::Value> const& args)
+	{
+		using iterator_type = detail::range_iterator<std::ranges::ref_view<T>>;
+
+		v8::Isolate* isolate = args.GetIsolate();
+		try
+		{
+			auto self = unwrap_object(isolate, args.This());
+			if (!self)
+			{
+				throw std::runtime_error("iterable object expected");
+			}
+			size_t const chunk_size = detail::external_data::get<size_t>(args.Data());
+			// the iterator keeps args.This() alive to reference its C++ range
+			args.GetReturnValue().Set(iterator_type::wrap(isolate,
+				std::make_unique<iterator_type>(isolate, std::ranges::ref_view<T>(*self), chunk_size, args.This())));
+		}
+		catch (std::exception const& ex)
+		{
+			args.GetReturnValue().Set(throw_ex(isolate, ex.what()));
+		}
+	}
+
+	// set arithmetic value without v8::Local<v8::Value> allocation
+	template<typename Value>
+	static void set_return_value(v8::ReturnValue<v8::Value> result, Value value)
+	{
+		if constexpr (std::same_as<Value, bool>)
+		{
+			result.Set(value);
+		}
+		else if constexpr (std::is_floating_point_v<Value>)
+		{
+			// also for long double, no ReturnValue::Set() overload for it
+			result.Set(static_cast<double>(value));
+		}
+		else if constexpr (sizeof(Value) <= sizeof(uint32_t) && std::is_signed_v<Value>)
+		{
+			result.Set(static_cast<int32_t>(value));
+		}
+		else if constexpr (sizeof(Value) <= sizeof(uint32_t))
+		{
+			result.Set(static_cast<uint32_t>(value));
+		}
+		else
+		{
+			result.Set(static_cast<double>(value));
+		}
+	}
+
+	// wrapped object of the class, or of a derived one with a slower lookup
+	static T* member_object(object_registry& registry, v8::Local<v8::Object> obj)
+	{
+		void* ptr = registry.object_pointer(obj);
+		if (ptr)
+		{
+			return static_cast<T*>(ptr);
+		}
+		return static_cast<T*>(Traits::pointer_id(registry.unwrap_object(obj)));
+	}
+
+	template<auto Member>
+	static void member_get_direct(v8::FunctionCallbackInfo<v8::Value> const& args)
+	{
+		object_registry* registry = detail::external_data::get<object_registry*>(args.Data());
+		T* self = member_object(*registry, args.This());
+		if (!self)
+		{
+			args.GetReturnValue().Set(throw_type_error(args.GetIsolate(), registry->class_name() + " object expected"));
+			return;
+		}
+		set_return_value(args.GetReturnValue(), (*self).*Member);
+	}
+
+	template<auto Member>
+	static void member_set_direct(v8::FunctionCallbackInfo<v8::Value> const& args)
+	{
+		using attr_type = std::remove_cvref_t<decltype(std::declval<T&>().*Member)>;
+
+		v8::Isolate* isolate = args.GetIsolate();
+		object_registry* registry = detail::external_data::get<object_registry*>(args.Data());
+		T* self = member_object(*registry, args.This());
+		if (!self)
+		{
+			throw_type_error(isolate, registry->class_name() + " object expected");
+			return;
+		}
+		v8::Local<v8::Value> value = args[0];
+		if (!convert<attr_type>::is_valid(isolate, value))
+		{
+			throw_type_error(isolate, std::same_as<attr_type, bool> ? "Boolean expected" : "Number expected");
+			return;
+		}
+		(*self).*Member = convert<attr_type>::from_v8(isolate, value);
+	}
 };
 
 /// Interface to access C++ classes bound to V8
@@ -514,10 +1043,472 @@ private:
 template<typename T>
 using shared_class = class_<T, shared_ptr_traits>;
 
+/// Interface to access C++ classes bound to V8
+/// Objects are exclusively owned by JavaScript and could be moved as std::unique_ptr
+template<typename T>
+using unique_class = class_<T, unique_ptr_traits>;
+
+/// Interface to access C++ classes bound to V8
+/// Objects have embedded reference counter
+template<typename T>
+using intrusive_class = class_<T, intrusive_ptr_traits>;
+
+/// Wrapped C++ object reference to pass into JavaScript calls, like call_v8().
+/// The JavaScript object, created in the current HandleScope, unwraps to the
+/// referenced C++ object only during the borrowed lifetime, and to nullptr
+/// after it. It is neither tracked nor weak, and should be used for objects
+/// living on the stack, e.g. `call_v8(isolate, func, recv, borrowed(isolate, frame))`
+template<typename T, typename Traits = raw_ptr_traits>
+class borrowed
+{
+public:
+	borrowed(v8::Isolate* isolate, T& object)
+		: registry_(detail::classes::find<Traits>(isolate, detail::type_id<std::remove_cv_t<T>>()))
+		, handle_(registry_.wrap_borrowed_object(Traits::key(const_cast<std::remove_cv_t<T>*>(&object))))
+	{
+	}
+
+	~borrowed()
+	{
+		registry_.release_borrowed_object(handle_);
+	}
+
+	borrowed(borrowed const&) = delete;
+	borrowed& operator=(borrowed const&) = delete;
+
+	/// JavaScript object for the borrowed C++ object
+	v8::Local<v8::Object> handle() const { return handle_; }
+
+private:
+	detail::object_registry<Traits>& registry_;
+	v8::Local<v8::Object> handle_;
+};
+
 void cleanup(v8::Isolate* isolate);
 
 } // namespace v8pp
 
+namespace v8pp::detail {
+
+/// Iterator object for a C++ range, converts range elements on demand
+template<typename Range>
+class range_iterator
+{
+public:
+	range_iterator(v8::Isolate* isolate, Range&& range, size_t chunk_size, v8::Local<v8::Value> owner = {})
+		: range_(std::move(range))
+		, it_(std::ranges::begin(range_))
+		, end_(std::ranges::end(range_))
+		, chunk_size_(chunk_size)
+		, owner_(isolate, owner)
+	{
+	}
+
+	range_iterator(range_iterator const&) = delete;
+	range_iterator& operator=(range_iterator const&) = delete;
+
+	/// Iterator protocol result object `{ value, done }`
+	v8::Local<v8::Object> next(v8::Isolate* isolate)
+	{
+		v8::EscapableHandleScope scope(isolate);
+		v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+		bool const done = (it_ == end_);
+		v8::Local<v8::Value> value;
+		if (done)
+		{
+			value = v8::Undefined(isolate);
+			owner_.Reset();
+		}
+		else if (chunk_size_)
+		{
+			v8::Local<v8::Array> chunk = v8::Array::New(isolate);
+			for (uint32_t idx = 0; idx < chunk_size_ && it_ != end_; ++idx, ++it_)
+			{
+				chunk->Set(context, idx, to_v8(isolate, *it_)).FromJust();
+			}
+			value = chunk;
+		}
+		else
+		{
+			value = to_v8(isolate, *it_);
+			++it_;
+		}
+
+		v8::Local<v8::Object> result = v8::Object::New(isolate);
+		result->CreateDataProperty(context, v8pp::to_v8(isolate, "value"), value).FromJust();
+		result->CreateDataProperty(context, v8pp::to_v8(isolate, "done"), v8::Boolean::New(isolate, done)).FromJust();
+		return scope.Escape(result);
+	}
+
+	/// Wrap the iterator into a JavaScript object which owns it
+	static v8::Local<v8::Object> wrap(v8::Isolate* isolate, std::unique_ptr<range_iterator> iterator)
+	{
+		using iterator_class = v8pp::class_<range_iterator, raw_ptr_traits>;
+
+		if (!classes::contains(isolate, type_id<range_iterator>()))
+		{
+			v8::HandleScope scope(isolate);
+
+			iterator_class iterator_class_(isolate);
+			iterator_class_.function("next", &range_iterator::next);
+			// iterators are iterable themselves
+			iterator_class_.class_function_template()->PrototypeTemplate()->Set(v8::Symbol::GetIterator(isolate),
+				v8::FunctionTemplate::New(isolate, [](v8::FunctionCallbackInfo<v8::Value> const& args)
+				{
+					args.GetReturnValue().Set(args.This());
+				}), v8::DontEnum);
+		}
+
+		v8::Local<v8::Object> result = iterator_class::import_external(isolate, iterator.get());
+		if (!result.IsEmpty())
+		{
+			iterator.release();
+		}
+		return result;
+	}
+
+private:
+	Range range_;
+	std::ranges::iterator_t<Range> it_;
+	std::ranges::sentinel_t<Range> end_;
+	size_t chunk_size_;
+	v8::Global<v8::Value> owner_; // JavaScript object with the range, if any
+};
+
+/// Array-like object for a vector, converts elements on access
+template<typename Vector>
+class array_proxy
+{
+public:
+	using value_type = typename Vector::value_type;
+
+	array_proxy(v8::Isolate* isolate, Vector&& values, bool cache)
+		: isolate_(isolate)
+		, values_(std::move(values))
+		, cache_enabled_(cache)
+	{
+	}
+
+	array_proxy(array_proxy const&) = delete;
+	array_proxy& operator=(array_proxy const&) = delete;
+
+	auto begin() const { return values_.begin(); }
+	auto end() const { return values_.end(); }
+	size_t size() const { return values_.size(); }
+
+	v8::Local<v8::Value> get(uint32_t index)
+	{
+		if (!cache_enabled_)
+		{
+			return to_v8(isolate_, values_[index]);
+		}
+
+		v8::Local<v8::Context> context = isolate_->GetCurrentContext();
+		v8::Local<v8::Array> cache;
+		if (cache_.IsEmpty())
+		{
+			cache = v8::Array::New(isolate_);
+			cache_.Reset(isolate_, cache);
+		}
+		else
+		{
+			cache = cache_.Get(isolate_);
+			if (cache->HasRealIndexedProperty(context, index).FromJust())
+			{
+				return cache->Get(context, index).ToLocalChecked();
+			}
+		}
+		v8::Local<v8::Value> value = to_v8(isolate_, values_[index]);
+		cache->Set(context, index, value).FromJust();
+		return value;
+	}
+
+	void set(uint32_t index, value_type const& value)
+	{
+		values_[index] = value;
+		if (!cache_.IsEmpty())
+		{
+			cache_.Get(isolate_)->Delete(isolate_->GetCurrentContext(), index).FromJust();
+		}
+	}
+
+	/// Wrap the proxy into a JavaScript object which owns it
+	static v8::Local<v8::Object> wrap(v8::Isolate* isolate, std::unique_ptr<array_proxy> proxy)
+	{
+		using proxy_class = v8pp::class_<array_proxy, raw_ptr_traits>;
+
+		if (!classes::contains(isolate, type_id<array_proxy>()))
+		{
+			v8::HandleScope scope(isolate);
+
+			proxy_class proxy_class_(isolate);
+			proxy_class_
+				.indexer(&array_proxy::get, &array_proxy::set, &array_proxy::size)
+				.iterable()
+				;
+		}
+
+		// external memory is the proxy with its elements, the JavaScript object owns it
+		size_t size = sizeof(array_proxy);
+		if constexpr (requires { proxy->values_.capacity(); })
+		{
+			size += proxy->values_.capacity() * sizeof(value_type);
+		}
+		else
+		{
+			size += proxy->values_.size() * sizeof(value_type);
+		}
+		v8::Local<v8::Object> result = classes::find<raw_ptr_traits>(isolate, type_id<array_proxy>())
+			.wrap_object(proxy.get(), size);
+		if (!result.IsEmpty())
+		{
+			proxy.release();
+		}
+		return result;
+	}
+
+private:
+	v8::Isolate* isolate_;
+	Vector values_;
+	bool cache_enabled_;
+	v8::Global<v8::Array> cache_; // converted elements, if enabled
+};
+
+} // namespace v8pp::detail
+
+namespace v8pp {
+
+/// JavaScript view class for T records stored in an ArrayBuffer, with
+/// v8pp::record<T> fields read and written in place. The view `index`
+/// property selects a record, so one view object visits all records.
+template<typename T>
+class record_view
+{
+public:
+	static_assert(std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>,
+		"T must be a trivially copyable standard layout type");
+
+	using class_type = v8pp::class_<record_view, raw_ptr_traits>;
+
+	/// JavaScript constructor `new View(buffer [, index])` for an ArrayBuffer
+	/// or ArrayBufferView
+	explicit record_view(v8::FunctionCallbackInfo<v8::Value> const& args)
+		: index_(0)
+	{
+		v8::Isolate* isolate = args.GetIsolate();
+		v8::Local<v8::Value> arg = args[0];
+		if (arg->IsArrayBuffer())
+		{
+			v8::Local<v8::ArrayBuffer> buffer = arg.As<v8::ArrayBuffer>();
+			store_ = buffer->GetBackingStore();
+			byte_offset_ = 0;
+			byte_length_ = buffer->ByteLength();
+		}
+		else if (arg->IsArrayBufferView())
+		{
+			v8::Local<v8::ArrayBufferView> view = arg.As<v8::ArrayBufferView>();
+			store_ = view->Buffer()->GetBackingStore();
+			byte_offset_ = view->ByteOffset();
+			byte_length_ = view->ByteLength();
+		}
+		else
+		{
+			throw invalid_argument(isolate, arg, "ArrayBuffer");
+		}
+
+		if ((reinterpret_cast<uintptr_t>(store_->Data()) + byte_offset_) % alignof(T))
+		{
+			throw std::invalid_argument("misaligned record buffer");
+		}
+		if (args.Length() > 1)
+		{
+			set_index(v8pp::from_v8<size_t>(isolate, args[1]));
+		}
+	}
+
+	/// Number of records in the buffer
+	size_t length() const { return byte_length_ / sizeof(T); }
+
+	/// Current record index
+	size_t index() const { return index_; }
+
+	void set_index(size_t index)
+	{
+		if (index >= length())
+		{
+			throw std::out_of_range("record index out of range");
+		}
+		index_ = index;
+	}
+
+	/// Current record in the buffer
+	T& record() const
+	{
+		if (index_ >= length())
+		{
+			throw std::out_of_range("record index out of range");
+		}
+		return reinterpret_cast<T*>(static_cast<char*>(store_->Data()) + byte_offset_)[index_];
+	}
+
+	/// Move records into an ArrayBuffer without copying. With V8 sandbox
+	/// backing stores must be allocated in the sandbox, so the records
+	/// are copied into a new ArrayBuffer.
+	template<typename Alloc>
+	static v8::Local<v8::ArrayBuffer> buffer(v8::Isolate* isolate, std::vector<T, Alloc>&& records)
+	{
+#ifdef V8_ENABLE_SANDBOX
+		size_t const byte_length = records.size() * sizeof(T);
+		std::unique_ptr<v8::BackingStore> store = v8::ArrayBuffer::NewBackingStore(isolate, byte_length);
+		if (byte_length)
+		{
+			std::memcpy(store->Data(), records.data(), byte_length);
+		}
+		records.clear();
+#else
+		auto owner = new std::vector<T, Alloc>(std::move(records));
+		std::unique_ptr<v8::BackingStore> store = v8::ArrayBuffer::NewBackingStore(
+			owner->data(), owner->size() * sizeof(T),
+			[](void*, size_t, void* deleter_data)
+			{
+				delete static_cast<std::vector<T, Alloc>*>(deleter_data);
+			}, owner);
+#endif
+		return v8::ArrayBuffer::New(isolate, std::move(store));
+	}
+
+	/// Register the view class in isolate, or find already registered one
+	static class_type bind(v8::Isolate* isolate)
+	{
+		if (detail::classes::contains(isolate, detail::type_id<record_view>()))
+		{
+			return class_type::extend(isolate);
+		}
+
+		v8::HandleScope scope(isolate);
+
+		class_type view_class(isolate);
+		view_class.template ctor<v8::FunctionCallbackInfo<v8::Value> const&>();
+		view_class.js_function_template()->Set(v8pp::to_v8(isolate, "BYTES_PER_RECORD"),
+			v8pp::to_v8(isolate, sizeof(T)), v8::PropertyAttribute(v8::ReadOnly | v8::DontDelete));
+
+		// instance properties, to call setters on assignment
+		v8::Local<v8::ObjectTemplate> instance = view_class.class_function_template()->InstanceTemplate();
+		instance->SetNativeDataProperty(v8pp::to_v8(isolate, "index"), &index_get, &index_set,
+			v8::Local<v8::Value>(), v8::PropertyAttribute(v8::DontDelete | v8::DontEnum));
+		instance->SetNativeDataProperty(v8pp::to_v8(isolate, "length"), &length_get, nullptr,
+			v8::Local<v8::Value>(), v8::PropertyAttribute(v8::ReadOnly | v8::DontDelete | v8::DontEnum));
+		std::apply([isolate, instance](auto const&... fields)
+			{
+				(set_field_accessor(isolate, instance, fields), ...);
+			}, v8pp::record<T>::fields);
+		return view_class;
+	}
+
+private:
+	template<typename Member>
+	static void set_field_accessor(v8::Isolate* isolate, v8::Local<v8::ObjectTemplate> instance,
+		record_field<T, Member> const& field)
+	{
+		Member T::*member = field.member;
+		instance->SetNativeDataProperty(v8pp::to_v8(isolate, field.name), &field_get<Member>, &field_set<Member>,
+			detail::external_data::set(isolate, std::move(member)), v8::DontDelete);
+	}
+
+	static record_view& self(v8::Isolate* isolate, v8::Local<v8::Object> obj)
+	{
+		record_view* view = class_type::unwrap_object(isolate, obj);
+		if (!view)
+		{
+			throw std::runtime_error("record view expected");
+		}
+		return *view;
+	}
+
+	template<typename Member>
+	static void field_get(v8::Local<v8::Name>, v8::PropertyCallbackInfo<v8::Value> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			Member T::*member = detail::external_data::get<Member T::*>(info.Data());
+			info.GetReturnValue().Set(v8pp::to_v8(isolate, self(isolate, info.This()).record().*member));
+		}
+		catch (std::exception const& ex)
+		{
+			info.GetReturnValue().Set(throw_ex(isolate, ex.what()));
+		}
+	}
+
+	template<typename Member>
+	static void field_set(v8::Local<v8::Name>, v8::Local<v8::Value> value, v8::PropertyCallbackInfo<void> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			Member T::*member = detail::external_data::get<Member T::*>(info.Data());
+			self(isolate, info.This()).record().*member = v8pp::from_v8<Member>(isolate, value);
+		}
+		catch (std::exception const& ex)
+		{
+			if (info.ShouldThrowOnError())
+			{
+				throw_ex(isolate, ex.what());
+			}
+		}
+	}
+
+	static void index_get(v8::Local<v8::Name>, v8::PropertyCallbackInfo<v8::Value> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			info.GetReturnValue().Set(v8pp::to_v8(isolate, self(isolate, info.This()).index()));
+		}
+		catch (std::exception const& ex)
+		{
+			info.GetReturnValue().Set(throw_ex(isolate, ex.what()));
+		}
+	}
+
+	static void index_set(v8::Local<v8::Name>, v8::Local<v8::Value> value, v8::PropertyCallbackInfo<void> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			self(isolate, info.This()).set_index(v8pp::from_v8<size_t>(isolate, value));
+		}
+		catch (std::exception const& ex)
+		{
+			if (info.ShouldThrowOnError())
+			{
+				throw_ex(isolate, ex.what());
+			}
+		}
+	}
+
+	static void length_get(v8::Local<v8::Name>, v8::PropertyCallbackInfo<v8::Value> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			info.GetReturnValue().Set(v8pp::to_v8(isolate, self(isolate, info.This()).length()));
+		}
+		catch (std::exception const& ex)
+		{
+			info.GetReturnValue().Set(throw_ex(isolate, ex.what()));
+		}
+	}
+
+	std::shared_ptr<v8::BackingStore> store_;
+	size_t byte_offset_;
+	size_t byte_length_;
+	size_t index_;
+};
+
+} // namespace v8pp
+
 #if V8PP_HEADER_ONLY
 #include "v8pp/class.ipp"
 #endif
@@ -33,6 +33,88 @@ V8PP_IMPL std::string class_info::class_name() const
 	return "v8pp::class_<" + std::string(type.name()) + ", " + std::string(traits.name()) + ">";
 }
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// destroy_queue
+//
+V8PP_IMPL destroy_queue& destroy_queue::instance()
+{
+	static destroy_queue queue;
+	return queue;
+}
+
+V8PP_IMPL destroy_queue::~destroy_queue()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	task_posted_.notify_one();
+	if (thread_.joinable())
+	{
+		thread_.join();
+	}
+}
+
+V8PP_IMPL void destroy_queue::post(std::function<void ()>&& task, pending_tasks& pending)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		tasks_.emplace_back(std::move(task), &pending);
+		++pending.count;
+		if (!thread_.joinable())
+		{
+			thread_ = std::thread(&destroy_queue::run, this);
+		}
+	}
+	task_posted_.notify_one();
+}
+
+V8PP_IMPL void destroy_queue::wait()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	tasks_done_.wait(lock, [this]() { return tasks_.empty() && running_ == 0; });
+}
+
+V8PP_IMPL void destroy_queue::wait(pending_tasks const& pending)
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	tasks_done_.wait(lock, [&pending]() { return pending.count == 0; });
+}
+
+V8PP_IMPL void destroy_queue::run()
+{
+	std::unique_lock<std::mutex> lock(mutex_);
+	for (;;)
+	{
+		task_posted_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+		if (tasks_.empty())
+		{
+			break; // stopped
+		}
+
+		auto [task, pending] = std::move(tasks_.front());
+		tasks_.pop_front();
+		++running_;
+		lock.unlock();
+		try
+		{
+			task();
+		}
+		catch (...)
+		{
+			// no way to report destructor failure
+		}
+		task = nullptr;
+		lock.lock();
+		--running_;
+		if (--pending->count == 0)
+		{
+			tasks_done_.notify_all();
+		}
+	}
+}
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // object_registry
@@ -40,10 +122,23 @@ V8PP_IMPL std::string class_info::class_name() const
 template<typename Traits>
 V8PP_IMPL object_registry<Traits>::object_registry(v8::Isolate* isolate, type_info const& type, dtor_function&& dtor)
 	: class_info(type, type_id<Traits>())
+	, untracked_objects_(nullptr)
+	, borrowed_objects_()
 	, isolate_(isolate)
 	, ctor_() // no wrapped class constructor available by default
 	, dtor_(std::move(dtor))
 	, auto_wrap_objects_(false)
+	, share_functions_(false)
+	, destroy_in_background_(false)
+	, destroy_tasks_posted_(false)
+	, destroy_tasks_()
+	, identity_tracking_(true)
+{
+	// class templates are created on first use, see create_templates()
+}
+
+template<typename Traits>
+V8PP_IMPL void object_registry<Traits>::create_templates()
 {
 	v8::HandleScope scope(isolate_);
 
@@ -74,22 +169,46 @@ V8PP_IMPL object_registry<Traits>::object_registry(v8::Isolate* isolate, type_in
 			{
 				args.GetReturnValue().Set(throw_ex(isolate, ex.what()));
 			}
-		}, external_data::set(isolate, this));
+		}, external_data::set(isolate_, this));
 
-	func_.Reset(isolate, func);
-	js_func_.Reset(isolate, js_func);
+	func_.Reset(isolate_, func);
+	js_func_.Reset(isolate_, js_func);
 
 	// each JavaScript instance has 2 internal fields:
-	//  0 - pointer to a wrapped C++ object
+	//  0 - pointer to a wrapped C++ object, or to untracked_object
 	//  1 - pointer to this object_registry
 	func->InstanceTemplate()->SetInternalFieldCount(2);
 	func->Inherit(js_func);
+
+	// apply bindings recorded before, in order
+	auto bindings = std::move(bindings_);
+	bindings_.clear();
+	for (auto& binding : bindings)
+	{
+		binding->apply(*this);
+	}
 }
 
 template<typename Traits>
 V8PP_IMPL object_registry<Traits>::~object_registry()
 {
 	remove_objects();
+	if (destroy_tasks_posted_)
+	{
+		// dtor_ should outlive objects being destroyed,
+		// even if destroy_in_background has been turned off since
+		destroy_queue::instance().wait(destroy_tasks_);
+	}
+}
+
+template<typename Traits>
+V8PP_IMPL void object_registry<Traits>::set_identity_tracking(bool tracking)
+{
+	if (tracking != identity_tracking_ && (!objects_.empty() || untracked_objects_))
+	{
+		throw std::runtime_error(class_name() + " identity tracking can't be changed for wrapped objects");
+	}
+	identity_tracking_ = tracking;
 }
 
 template<typename Traits>
@@ -141,6 +260,24 @@ V8PP_IMPL bool object_registry<Traits>::cast(pointer_type& ptr, type_info const&
 template<typename Traits>
 V8PP_IMPL void object_registry<Traits>::remove_object(object_id const& obj)
 {
+	if (!identity_tracking_)
+	{
+		// no index for untracked objects, the first wrapper found is removed
+		for (untracked_object* node = untracked_objects_; node; node = node->next)
+		{
+			if (Traits::pointer_id(node->object) == obj)
+			{
+				v8::HandleScope scope(isolate_);
+				unlink_untracked_object(node);
+				reset_object(node->object, node->wrapped);
+				delete node;
+				return;
+			}
+		}
+		assert(false && "no object");
+		return;
+	}
+
 	auto it = objects_.find(Traits::key(obj));
 	assert(it != objects_.end() && "no object");
 	if (it != objects_.end())
@@ -160,6 +297,203 @@ V8PP_IMPL void object_registry<Traits>::remove_objects()
 		reset_object(object_wrapped.first, object_wrapped.second);
 	}
 	objects_.clear();
+	dead_objects_.clear();
+
+	while (untracked_object* node = untracked_objects_)
+	{
+		untracked_objects_ = node->next;
+		reset_object(node->object, node->wrapped);
+		delete node;
+	}
+	for (untracked_object* node : dead_untracked_objects_)
+	{
+		reset_object(node->object, node->wrapped);
+		delete node;
+	}
+	dead_untracked_objects_.clear();
+}
+
+template<typename Traits>
+V8PP_IMPL void object_registry<Traits>::sweep_objects()
+{
+	if (dead_objects_.empty() && dead_untracked_objects_.empty())
+	{
+		return;
+	}
+
+	auto const start = std::chrono::steady_clock::now();
+
+	std::vector<object_id> dead_objects;
+	dead_objects.swap(dead_objects_);
+	// remove in address order for better memory locality
+	std::sort(dead_objects.begin(), dead_objects.end(), std::less<object_id>{});
+
+	std::vector<pointer_type> destroyed;
+	size_t destroyed_size = 0;
+	for (object_id const& id : dead_objects)
+	{
+		auto it = objects_.find(Traits::key(id));
+		// skip removed or re-wrapped objects
+		if (it == objects_.end() || !it->second.pobj.IsEmpty())
+		{
+			continue;
+		}
+		if (it->second.size)
+		{
+			destroyed_size += it->second.size;
+			destroyed.emplace_back(it->first);
+		}
+		objects_.erase(it);
+	}
+
+	std::vector<untracked_object*> dead_untracked_objects;
+	dead_untracked_objects.swap(dead_untracked_objects_);
+	std::sort(dead_untracked_objects.begin(), dead_untracked_objects.end(),
+		[](untracked_object const* lhs, untracked_object const* rhs)
+		{
+			return std::less<object_id>{}(Traits::pointer_id(lhs->object), Traits::pointer_id(rhs->object));
+		});
+	for (untracked_object* node : dead_untracked_objects)
+	{
+		if (node->wrapped.size)
+		{
+			destroyed_size += node->wrapped.size;
+			destroyed.emplace_back(node->object);
+		}
+		delete node;
+	}
+
+	if (destroyed_size)
+	{
+		decrease_allocated_memory(destroyed_size);
+	}
+	if (destroy_in_background_ && !destroyed.empty())
+	{
+		destroy_tasks_posted_ = true;
+		destroy_queue::instance().post([this, destroyed = std::move(destroyed)]()
+		{
+			for (pointer_type const& object : destroyed)
+			{
+				dtor_(isolate_, object);
+			}
+		}, destroy_tasks_);
+	}
+	else
+	{
+		for (pointer_type const& object : destroyed)
+		{
+			dtor_(isolate_, object);
+		}
+	}
+
+	auto const duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - start);
+	++sweep_stats_.sweeps;
+	size_t const objects = dead_objects.size() + dead_untracked_objects.size();
+	sweep_stats_.objects += objects;
+	sweep_stats_.max_objects = std::max(sweep_stats_.max_objects, objects);
+	sweep_stats_.duration += duration;
+	sweep_stats_.max_duration = std::max(sweep_stats_.max_duration, duration);
+}
+
+template<typename Traits>
+V8PP_IMPL void object_registry<Traits>::object_collected(
+	v8::WeakCallbackInfo<typename objects_map::value_type> const& data)
+{
+	// first pass: only reset the handle and remember the object
+	object_id object = data.GetInternalField(0);
+	object_registry* this_ = static_cast<object_registry*>(data.GetInternalField(1));
+	data.GetParameter()->second.pobj.Reset();
+	if (this_->dead_objects_.empty())
+	{
+		// a single second pass callback removes all objects collected in GC
+		data.SetSecondPassCallback(&object_registry::objects_collected);
+	}
+	this_->dead_objects_.emplace_back(object);
+}
+
+template<typename Traits>
+V8PP_IMPL void object_registry<Traits>::objects_collected(
+	v8::WeakCallbackInfo<typename objects_map::value_type> const& data)
+{
+	object_registry* this_ = static_cast<object_registry*>(data.GetInternalField(1));
+	// second pass callback may be invoked later, when the registry has been removed
+	if (classes::contains(data.GetIsolate(), this_))
+	{
+		this_->sweep_objects();
+	}
+}
+
+template<typename Traits>
+V8PP_IMPL void object_registry<Traits>::untracked_object_collected(
+	v8::WeakCallbackInfo<untracked_object> const& data)
+{
+	untracked_object* node = data.GetParameter();
+	object_registry* this_ = static_cast<object_registry*>(data.GetInternalField(1));
+	node->wrapped.pobj.Reset();
+	this_->unlink_untracked_object(node);
+	if (this_->dead_untracked_objects_.empty())
+	{
+		data.SetSecondPassCallback(&object_registry::untracked_objects_collected);
+	}
+	this_->dead_untracked_objects_.emplace_back(node);
+}
+
+template<typename Traits>
+V8PP_IMPL void object_registry<Traits>::untracked_objects_collected(
+	v8::WeakCallbackInfo<untracked_object> const& data)
+{
+	object_registry* this_ = static_cast<object_registry*>(data.GetInternalField(1));
+	if (classes::contains(data.GetIsolate(), this_))
+	{
+		this_->sweep_objects();
+	}
+}
+
+template<typename Traits>
+V8PP_IMPL void object_registry<Traits>::unlink_untracked_object(untracked_object* node)
+{
+	if (node->prev)
+	{
+		node->prev->next = node->next;
+	}
+	else
+	{
+		untracked_objects_ = node->next;
+	}
+	if (node->next)
+	{
+		node->next->prev = node->prev;
+	}
+	node->prev = node->next = nullptr;
+}
+
+template<typename Traits>
+V8PP_IMPL typename object_registry<Traits>::pointer_type
+object_registry<Traits>::find_untracked_object(untracked_object* node, type_info const& actual_type) const
+{
+	pointer_type ptr = node->object;
+	if (cast(ptr, actual_type))
+	{
+		return ptr;
+	}
+	return nullptr;
+}
+
+template<typename Traits>
+V8PP_IMPL typename object_registry<Traits>::pointer_type
+object_registry<Traits>::find_wrapped_object(object_id id, type_info const& actual_type) const
+{
+	if (is_borrowed(id))
+	{
+		pointer_type ptr = *static_cast<pointer_type const*>(id);
+		return ptr && cast(ptr, actual_type) ? ptr : nullptr;
+	}
+	if (!identity_tracking_)
+	{
+		return find_untracked_object(static_cast<untracked_object*>(id), actual_type);
+	}
+	return find_object(id, actual_type);
 }
 
 template<typename Traits>
@@ -204,7 +538,10 @@ V8PP_IMPL v8::Local<v8::Object> object_registry<Traits>::wrap_object(pointer_typ
 		return {};
 	}
 
-	auto it = objects_.find(object);
+	// remove objects collected in GC, that might have the same address
+	sweep_objects();
+
+	auto it = identity_tracking_ ? objects_.find(object) : objects_.end();
 	if (it != objects_.end())
 	{
 		//assert(false && "duplicate object");
@@ -220,17 +557,26 @@ V8PP_IMPL v8::Local<v8::Object> object_registry<Traits>::wrap_object(pointer_typ
 	if (class_function_template()->GetFunction(context).ToLocal(&func)
 		&& func->NewInstance(context).ToLocal(&obj))
 	{
-		obj->SetAlignedPointerInInternalField(0, Traits::pointer_id(object));
 		obj->SetAlignedPointerInInternalField(1, this);
+		if (identity_tracking_)
+		{
+			obj->SetAlignedPointerInInternalField(0, Traits::pointer_id(object));
 
-		v8::Global<v8::Object> pobj(isolate_, obj);
-		pobj.SetWeak(this, [](v8::WeakCallbackInfo<object_registry> const& data)
+			// the map element is stable, use it as the weak callback parameter
+			auto& entry = *objects_.emplace(object, wrapped_object{ v8::Global<v8::Object>(isolate_, obj), size }).first;
+			entry.second.pobj.SetWeak(&entry, &object_registry::object_collected, v8::WeakCallbackType::kInternalFields);
+		}
+		else
+		{
+			auto node = new untracked_object{ object, wrapped_object{ v8::Global<v8::Object>(isolate_, obj), size }, nullptr, untracked_objects_ };
+			if (untracked_objects_)
 			{
-				object_id object = data.GetInternalField(0);
-				object_registry* this_ = static_cast<object_registry*>(data.GetInternalField(1));
-				this_->remove_object(object);
-			}, v8::WeakCallbackType::kInternalFields);
-		objects_.emplace(object, wrapped_object{ std::move(pobj), size });
+				untracked_objects_->prev = node;
+			}
+			untracked_objects_ = node;
+			obj->SetAlignedPointerInInternalField(0, node);
+			node->wrapped.pobj.SetWeak(node, &object_registry::untracked_object_collected, v8::WeakCallbackType::kInternalFields);
+		}
 		if (size)
 		{
 			increase_allocated_memory(size);
@@ -248,6 +594,9 @@ V8PP_IMPL v8::Local<v8::Object> object_registry<Traits>::wrap_object(v8::Functio
 		//assert(false && "create not allowed");
 		throw std::runtime_error(class_name() + " has no constructor");
 	}
+	// constructed object may keep its std::pmr arguments,
+	// don't allocate them in a call arena of an outer wrapped function
+	no_call_arena no_arena;
 	auto [object, size] = ctor_(args);
 	return wrap_object(object, size);
 }
@@ -258,6 +607,97 @@ object_registry<Traits>::unwrap_object(v8::Local<v8::Value> value)
 {
 	v8::HandleScope scope(isolate_);
 
+	while (value->IsObject())
+	{
+		v8::Local<v8::Object> obj = value.As<v8::Object>();
+		pointer_type ptr = unwrap_own_object(obj);
+		if (ptr)
+		{
+			return ptr;
+		}
+#if V8_MAJOR_VERSION > 12 || (V8_MAJOR_VERSION == 12 && V8_MINOR_VERSION >= 9)
+		value = obj->GetPrototypeV2();
+#else
+		value = obj->GetPrototype();
+#endif
+	}
+	return nullptr;
+}
+
+template<typename Traits>
+V8PP_IMPL typename object_registry<Traits>::pointer_type
+object_registry<Traits>::unwrap_own_object(v8::Local<v8::Object> obj) const
+{
+	if (obj->InternalFieldCount() == 2)
+	{
+		object_id id = obj->GetAlignedPointerFromInternalField(0);
+		if (id)
+		{
+			auto registry = static_cast<object_registry*>(
+				obj->GetAlignedPointerFromInternalField(1));
+			if (registry)
+			{
+				return registry->find_wrapped_object(id, type);
+			}
+		}
+	}
+	return nullptr;
+}
+
+template<typename Traits>
+V8PP_IMPL v8::Local<v8::Object> object_registry<Traits>::wrap_borrowed_object(pointer_type const& object)
+{
+	if (!object)
+	{
+		return {};
+	}
+
+	auto slot = std::find(borrowed_objects_.begin(), borrowed_objects_.end(), nullptr);
+	if (slot == borrowed_objects_.end())
+	{
+		throw std::runtime_error(class_name() + " has too many borrowed objects");
+	}
+
+	v8::EscapableHandleScope scope(isolate_);
+
+	v8::Local<v8::Context> context = isolate_->GetCurrentContext();
+	v8::Local<v8::Function> func;
+	v8::Local<v8::Object> obj;
+	if (class_function_template()->GetFunction(context).ToLocal(&func)
+		&& func->NewInstance(context).ToLocal(&obj))
+	{
+		// neither tracked nor weak, the slot is released along with v8pp::borrowed
+		*slot = object;
+		obj->SetAlignedPointerInInternalField(0, &*slot);
+		obj->SetAlignedPointerInInternalField(1, this);
+	}
+
+	return scope.Escape(obj);
+}
+
+template<typename Traits>
+V8PP_IMPL void object_registry<Traits>::release_borrowed_object(v8::Local<v8::Object> obj)
+{
+	if (obj.IsEmpty())
+	{
+		return;
+	}
+
+	object_id id = obj->GetAlignedPointerFromInternalField(0);
+	if (is_borrowed(id))
+	{
+		// escaped references to the object unwrap to null
+		*static_cast<pointer_type*>(id) = nullptr;
+		obj->SetAlignedPointerInInternalField(0, nullptr);
+	}
+}
+
+template<typename Traits>
+V8PP_IMPL typename object_registry<Traits>::pointer_type
+object_registry<Traits>::release_object(v8::Local<v8::Value> value)
+{
+	v8::HandleScope scope(isolate_);
+
 	while (value->IsObject())
 	{
 		v8::Local<v8::Object> obj = value.As<v8::Object>();
@@ -268,11 +708,47 @@ object_registry<Traits>::unwrap_object(v8::Local<v8::Value> value)
 			{
 				auto registry = static_cast<object_registry*>(
 					obj->GetAlignedPointerFromInternalField(1));
-				if (registry)
+				if (registry && registry->is_borrowed(id))
+				{
+					if (registry->find_wrapped_object(id, type))
+					{
+						throw std::runtime_error(registry->class_name()
+							+ " object " + pointer_str(id) + " is borrowed, not owned by JavaScript");
+					}
+				}
+				else if (registry && !registry->identity_tracking_)
+				{
+					auto node = static_cast<untracked_object*>(id);
+					pointer_type ptr = registry->find_untracked_object(node, type);
+					if (ptr)
+					{
+						if (node->wrapped.size == 0)
+						{
+							throw std::runtime_error(registry->class_name()
+								+ " object " + pointer_str(Traits::pointer_id(node->object)) + " is not owned by JavaScript");
+						}
+						registry->decrease_allocated_memory(node->wrapped.size);
+						obj->SetAlignedPointerInInternalField(0, nullptr);
+						registry->unlink_untracked_object(node);
+						delete node;
+						return ptr;
+					}
+				}
+				else if (registry)
 				{
 					pointer_type ptr = registry->find_object(id, type);
 					if (ptr)
 					{
+						auto it = registry->objects_.find(Traits::key(id));
+						if (it->second.size == 0)
+						{
+							throw std::runtime_error(registry->class_name()
+								+ " object " + pointer_str(id) + " is not owned by JavaScript");
+						}
+						registry->decrease_allocated_memory(it->second.size);
+						obj->SetAlignedPointerInInternalField(0, nullptr);
+						it->second.pobj.Reset();
+						registry->objects_.erase(it);
 						return ptr;
 					}
 				}
@@ -293,7 +769,20 @@ V8PP_IMPL void object_registry<Traits>::reset_object(pointer_type const& object,
 	if (wrapped.size)
 	{
 		decrease_allocated_memory(wrapped.size);
-		dtor_(isolate_, object);
+		if (destroy_in_background_)
+		{
+			destroy_tasks_posted_ = true;
+			destroy_queue::instance().post([this, object]() { dtor_(isolate_, object); }, destroy_tasks_);
+		}
+		else
+		{
+			dtor_(isolate_, object);
+		}
+	}
+	if (!wrapped.pobj.IsEmpty())
+	{
+		// the JavaScript object may outlive its C++ object, see object_pointer()
+		to_local(isolate_, wrapped.pobj)->SetAlignedPointerInInternalField(0, nullptr);
 	}
 	wrapped.pobj.Reset();
 }
@@ -374,6 +863,19 @@ V8PP_IMPL void classes::remove_all(v8::Isolate* isolate)
 	instance(operation::remove, isolate);
 }
 
+V8PP_IMPL bool classes::contains(v8::Isolate* isolate, class_info const* info)
+{
+	classes* all = instance(operation::get, isolate);
+	return all && std::any_of(all->classes_.begin(), all->classes_.end(),
+		[info](classes_info::value_type const& registered) { return registered.get() == info; });
+}
+
+V8PP_IMPL bool classes::contains(v8::Isolate* isolate, type_info const& type)
+{
+	classes* all = instance(operation::get, isolate);
+	return all && all->find(type) != all->classes_.end();
+}
+
 V8PP_IMPL classes::classes_info::iterator classes::find(type_info const& type)
 {
 	return std::find_if(classes_.begin(), classes_.end(),
@@ -385,44 +887,16 @@ V8PP_IMPL classes::classes_info::iterator classes::find(type_info const& type)
 
 V8PP_IMPL classes* classes::instance(operation op, v8::Isolate* isolate)
 {
-#if defined(V8PP_ISOLATE_DATA_SLOT)
-	classes* info = static_cast<classes*>(
-		isolate->GetData(V8PP_ISOLATE_DATA_SLOT));
-	switch (op)
-	{
-	case operation::get:
-		return info;
-	case operation::add:
-		if (!info)
-		{
-			info = new classes;
-			isolate->SetData(V8PP_ISOLATE_DATA_SLOT, info);
-		}
-		return info;
-	case operation::remove:
-		if (info)
-		{
-			delete info;
-			isolate->SetData(V8PP_ISOLATE_DATA_SLOT, nullptr);
-		}
-		return nullptr;
-	}
-#else
-	static std::unordered_map<v8::Isolate*, classes> instances;
 	switch (op)
 	{
 	case operation::get:
-		{
-			auto it = instances.find(isolate);
-			return it != instances.end() ? &it->second : nullptr;
-		}
+		return isolate_data::find<classes>(isolate);
 	case operation::add:
-		return &instances[isolate];
+		return &isolate_data::get<classes>(isolate);
 	case operation::remove:
-		instances.erase(isolate);
+		isolate_data::remove<classes>(isolate);
 		return nullptr;
 	}
-#endif
 	return nullptr; // should never reach this line
 }
 
@@ -434,6 +908,9 @@ V8PP_IMPL void cleanup(v8::Isolate* isolate)
 {
 	detail::classes::remove_all(isolate);
 	detail::external_data::destroy_all(isolate);
+	detail::string_table::remove(isolate);
+	detail::js_function_cache::remove(isolate);
+	detail::function_template_cache::remove(isolate);
 }
 
 } // namespace v8pp
@@ -3,16 +3,27 @@
 #include <v8.h>
 
 #include <algorithm>
+#include <functional>
+#include <iterator>
 #include <limits>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <ranges>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
+#include <utility>
 #include <variant>
+#include <vector>
 #include <optional>
 
+#include "v8pp/config.hpp"
 #include "v8pp/ptr_traits.hpp"
+#include "v8pp/throw_ex.hpp"
+#include "v8pp/type_info.hpp"
 #include "v8pp/utility.hpp"
 
 namespace v8pp {
@@ -20,9 +31,367 @@ namespace v8pp {
 template<typename T, typename Traits>
 class class_;
 
+template<typename T, typename Traits>
+class borrowed;
+
+namespace detail {
+template<typename Range>
+class range_iterator;
+template<typename Vector>
+class array_proxy;
+} // namespace detail
+
+/// C++ range converted to JavaScript iterator object with lazy conversion
+/// of range elements, optionally in arrays of up to chunk_size elements
+template<std::ranges::input_range Range>
+struct lazy_range
+{
+	Range range;
+	size_t chunk_size = 0;
+};
+
+/// Make lazy_range for a view or a range. An lvalue range is referenced
+/// and should outlive the JavaScript iterator, an rvalue range is moved into.
+template<std::ranges::viewable_range Range>
+lazy_range<std::views::all_t<Range>> make_lazy_range(Range&& range, size_t chunk_size = 0)
+{
+	return { std::views::all(std::forward<Range>(range)), chunk_size };
+}
+
+/// std::vector converted to JavaScript array-like object with lazy conversion
+/// of accessed elements, optionally cached in the object
+template<typename T, typename Alloc = std::allocator<T>>
+struct lazy_array
+{
+	std::vector<T, Alloc> values;
+	bool cache = false;
+};
+
+/// Make lazy_array from a vector moved into
+template<typename T, typename Alloc>
+lazy_array<T, Alloc> make_lazy_array(std::vector<T, Alloc> values, bool cache = false)
+{
+	return { std::move(values), cache };
+}
+
+/// Mapping converted to and from JavaScript Map, instead of Object
+template<typename Mapping>
+struct js_map
+{
+	Mapping values;
+};
+
+namespace detail {
+
+// Per-isolate v8pp data of different types, stored in V8PP_ISOLATE_DATA_SLOT
+// of the isolate. Like the isolate itself, it is used by one thread at a time.
+class isolate_data
+{
+public:
+	/// Data of type T in the isolate, nullptr if it doesn't exist
+	template<typename T>
+	static T* find(v8::Isolate* isolate)
+	{
+		isolate_data* data = instance(isolate, false);
+		return data ? static_cast<T*>(data->find(type_id<T>())) : nullptr;
+	}
+
+	/// Data of type T in the isolate, created on first use
+	template<typename T>
+	static T& get(v8::Isolate* isolate)
+	{
+		isolate_data* data = instance(isolate, true);
+		void* ptr = data->find(type_id<T>());
+		if (!ptr)
+		{
+			ptr = new T;
+			data->entries_.push_back(entry{ type_id<T>(), data_ptr(ptr, [](void* p) { delete static_cast<T*>(p); }) });
+		}
+		return *static_cast<T*>(ptr);
+	}
+
+	/// Destroy data of type T in the isolate
+	template<typename T>
+	static void remove(v8::Isolate* isolate)
+	{
+		remove(isolate, type_id<T>());
+	}
+
+private:
+	using data_ptr = std::unique_ptr<void, void (*)(void*)>;
+
+	struct entry
+	{
+		type_info type;
+		data_ptr data;
+	};
+
+	void* find(type_info const& type) const;
+
+	static isolate_data* instance(v8::Isolate* isolate, bool create);
+	static void remove(v8::Isolate* isolate, type_info const& type);
+
+	std::vector<entry> entries_;
+};
+
+struct string_atom
+{
+	std::string value;
+	size_t hash;
+	v8::Isolate* isolate; // nullptr after the string table has been destroyed
+	v8::Global<v8::String> handle;
+};
+
+// Per-isolate table of interned strings, keyed by V8 string identity hash.
+// Strings not referenced outside of the table are evicted as the table grows,
+// the table is destroyed in v8pp::cleanup(), but interned strings stay valid.
+class string_table
+{
+public:
+	string_table() = default;
+	string_table(string_table const&) = delete;
+	string_table& operator=(string_table const&) = delete;
+	~string_table();
+
+	static string_table& instance(v8::Isolate* isolate);
+	static void remove(v8::Isolate* isolate);
+
+	std::shared_ptr<string_atom const> intern(v8::Isolate* isolate, v8::Local<v8::String> str);
+
+	/// Internalized V8 string for a property name, created once
+	std::shared_ptr<string_atom const> key(v8::Isolate* isolate, std::string_view name);
+
+private:
+	std::shared_ptr<string_atom> find(v8::Isolate* isolate, v8::Local<v8::String> str, int hash) const;
+	std::shared_ptr<string_atom> add(v8::Isolate* isolate, v8::Local<v8::String> str, int hash);
+	void evict_unused();
+
+	std::unordered_multimap<int, std::shared_ptr<string_atom>> atoms_;
+	std::unordered_map<std::string_view, std::shared_ptr<string_atom const>> keys_;
+	size_t evict_size_ = 64;
+};
+
+} // namespace detail
+
+/// Immutable string converted from V8 once per isolate and shared then.
+/// Interned strings from the same isolate are compared by pointer.
+class interned_string
+{
+public:
+	interned_string() = default;
+
+	std::string const& str() const
+	{
+		static std::string const empty;
+		return atom_ ? atom_->value : empty;
+	}
+
+	std::string_view view() const { return str(); }
+	operator std::string_view() const { return str(); }
+
+	char const* c_str() const { return str().c_str(); }
+	size_t size() const { return str().size(); }
+	bool empty() const { return str().empty(); }
+
+	size_t hash() const { return atom_ ? atom_->hash : std::hash<std::string_view>{}(view()); }
+
+	friend bool operator==(interned_string const& lhs, interned_string const& rhs)
+	{
+		if (lhs.atom_ == rhs.atom_) return true;
+		// content comparison for strings from different tables
+		bool const same_table = lhs.atom_ && rhs.atom_ && lhs.atom_->isolate
+			&& lhs.atom_->isolate == rhs.atom_->isolate;
+		return !same_table && lhs.view() == rhs.view();
+	}
+
+	friend bool operator<(interned_string const& lhs, interned_string const& rhs)
+	{
+		return lhs.view() < rhs.view();
+	}
+
+private:
+	friend struct convert<interned_string>;
+
+	explicit interned_string(std::shared_ptr<detail::string_atom const> atom)
+		: atom_(std::move(atom))
+	{
+	}
+
+	std::shared_ptr<detail::string_atom const> atom_;
+};
+
+/// Named data member of a record struct
+template<typename Class, typename Member>
+struct record_field
+{
+	char const* name;
+	Member Class::*member;
+};
+
+/// Make record_field for a data member
+template<typename Class, typename Member>
+constexpr record_field<Class, Member> field(char const* name, Member Class::*member)
+{
+	return { name, member };
+}
+
+/// Record struct description, specialize it with a static constexpr tuple
+/// of v8pp::field(name, member) values:
+/// template<> struct v8pp::record<Point>
+/// {
+/// 	static constexpr auto fields = std::make_tuple(v8pp::field("x", &Point::x), v8pp::field("y", &Point::y));
+/// };
+template<typename T>
+struct record;
+
+/// Vector of records converted to JavaScript object of typed arrays,
+/// one per record field, and back
+template<typename T, typename Alloc = std::allocator<T>>
+struct columnar
+{
+	std::vector<T, Alloc> rows;
+};
+
 template<typename T>
 struct is_wrapped_class;
 
+namespace detail {
+
+// Memory resource for std::pmr containers converted from V8, if set
+inline std::pmr::memory_resource*& current_conversion_resource()
+{
+	thread_local std::pmr::memory_resource* resource = nullptr;
+	return resource;
+}
+
+/// Memory resource for std::pmr containers converted from V8 values:
+/// the one set by conversion_resource_scope, or the default one
+inline std::pmr::memory_resource* conversion_resource()
+{
+	std::pmr::memory_resource* resource = current_conversion_resource();
+	return resource ? resource : std::pmr::get_default_resource();
+}
+
+/// Set conversion_resource() in the current thread for a scope
+class conversion_resource_scope
+{
+public:
+	explicit conversion_resource_scope(std::pmr::memory_resource* resource)
+		: prev_(std::exchange(current_conversion_resource(), resource))
+	{
+	}
+
+	~conversion_resource_scope()
+	{
+		current_conversion_resource() = prev_;
+	}
+
+	conversion_resource_scope(conversion_resource_scope const&) = delete;
+	conversion_resource_scope& operator=(conversion_resource_scope const&) = delete;
+
+private:
+	std::pmr::memory_resource* prev_;
+};
+
+// Allocator for a container converted from V8
+template<typename Alloc>
+Alloc conversion_allocator()
+{
+	if constexpr (std::same_as<Alloc, std::pmr::polymorphic_allocator<typename Alloc::value_type>>)
+	{
+		return Alloc(conversion_resource());
+	}
+	else
+	{
+		return Alloc();
+	}
+}
+
+// Empty container to convert from V8, std::pmr ones use conversion_resource()
+template<typename Container>
+Container make_container()
+{
+	if constexpr (is_pmr_container<Container>::value)
+	{
+		return Container(conversion_allocator<typename Container::allocator_type>());
+	}
+	else
+	{
+		return Container{};
+	}
+}
+
+/// Array of JavaScript iterable object elements: an Array itself, Set values,
+/// or values of an object iterator, with a next() call per element. Empty if the value is not iterable,
+/// throws std::runtime_error with a JavaScript exception message from the iteration
+v8::MaybeLocal<v8::Array> iterable_to_array(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value);
+
+/// Object.prototype of the context global, or null
+v8::Local<v8::Value> object_prototype(v8::Isolate* isolate, v8::Local<v8::Context> context);
+
+/// Converter with from_v8(isolate, context, value)
+template<typename Convert>
+concept context_from_v8 = requires(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+{
+	Convert::from_v8(isolate, context, value);
+};
+
+/// Converter with to_v8(isolate, context, value)
+template<typename Convert, typename T>
+concept context_to_v8 = requires(v8::Isolate* isolate, v8::Local<v8::Context> context, T&& value)
+{
+	Convert::to_v8(isolate, context, std::forward<T>(value));
+};
+
+// Convert from V8 in a known context, if the converter uses it
+template<typename Convert>
+decltype(auto) from_v8_in(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+{
+	if constexpr (context_from_v8<Convert>)
+	{
+		return Convert::from_v8(isolate, context, value);
+	}
+	else
+	{
+		return Convert::from_v8(isolate, value);
+	}
+}
+
+// Convert to V8 in a known context, if the converter uses it
+template<typename Convert, typename T>
+decltype(auto) to_v8_in(v8::Isolate* isolate, v8::Local<v8::Context> context, T&& value)
+{
+	if constexpr (context_to_v8<Convert, T>)
+	{
+		return Convert::to_v8(isolate, context, std::forward<T>(value));
+	}
+	else
+	{
+		return Convert::to_v8(isolate, std::forward<T>(value));
+	}
+}
+
+// class_ to convert sequence elements, pointers to a wrapped class, in bulk
+template<typename T, typename Enable = void>
+struct wrapped_element
+{
+	using class_type = void;
+};
+
+template<typename T>
+struct wrapped_element<T*, typename std::enable_if<is_wrapped_class<T>::value>::type>
+{
+	using class_type = class_<std::remove_cv_t<T>, raw_ptr_traits>;
+};
+
+template<typename T>
+struct wrapped_element<std::shared_ptr<T>, typename std::enable_if<is_wrapped_class<T>::value>::type>
+{
+	using class_type = class_<std::remove_cv_t<T>, shared_ptr_traits>;
+};
+
+} // namespace detail
+
 // Generic convertor
 /*
 template<typename T, typename Enable = void>
@@ -35,6 +404,10 @@ struct convert
 
 	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value);
 	static to_type to_v8(v8::Isolate* isolate, T const& value);
+
+	// optional, for converters that use a context
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value);
+	static to_type to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, T const& value);
 };
 */
 
@@ -49,14 +422,16 @@ struct convert<String, typename std::enable_if<detail::is_string<String>::value>
 {
 	using Char = typename String::value_type;
 	using Traits = typename String::traits_type;
+	using Alloc = typename std::conditional_t<detail::is_pmr_container<String>::value,
+		std::pmr::polymorphic_allocator<Char>, std::allocator<Char>>;
 
 	static_assert(sizeof(Char) <= sizeof(uint16_t),
 		"only UTF-8 and UTF-16 strings are supported");
 
 	// A string that converts to Char const*
-	struct convertible_string : std::basic_string<Char, Traits>
+	struct convertible_string : std::basic_string<Char, Traits, Alloc>
 	{
-		using base_class = std::basic_string<Char, Traits>;
+		using base_class = std::basic_string<Char, Traits, Alloc>;
 		using base_class::base_class;
 		operator Char const*() const { return this->c_str(); }
 	};
@@ -70,6 +445,11 @@ struct convert<String, typename std::enable_if<detail::is_string<String>::value>
 	}
 
 	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
 	{
 		if (!is_valid(isolate, value))
 		{
@@ -77,20 +457,20 @@ struct convert<String, typename std::enable_if<detail::is_string<String>::value>
 		}
 
 		v8::HandleScope scope(isolate);
-		v8::Local<v8::String> str = value->ToString(isolate->GetCurrentContext()).ToLocalChecked();
+		v8::Local<v8::String> str = value->ToString(context).ToLocalChecked();
 
 #if V8_MAJOR_VERSION > 13 || (V8_MAJOR_VERSION == 13 && V8_MINOR_VERSION >= 3)
 		if constexpr (sizeof(Char) == 1)
 		{
 			auto const len = str->Utf8LengthV2(isolate);
-			from_type result(len, 0);
+			from_type result(len, 0, detail::conversion_allocator<Alloc>());
 			result.resize(str->WriteUtf8V2(isolate, result.data(), len));
 			return result;
 		}
 		else
 		{
 			auto const len = str->Length();
-			from_type result(len, 0);
+			from_type result(len, 0, detail::conversion_allocator<Alloc>());
 			str->WriteV2(isolate, 0, len, reinterpret_cast<uint16_t*>(result.data()));
 			return result;
 		}
@@ -98,14 +478,14 @@ struct convert<String, typename std::enable_if<detail::is_string<String>::value>
 		if constexpr (sizeof(Char) == 1)
 		{
 			auto const len = str->Utf8Length(isolate);
-			from_type result(len, 0);
+			from_type result(len, 0, detail::conversion_allocator<Alloc>());
 			result.resize(str->WriteUtf8(isolate, result.data(), len, nullptr, v8::String::NO_NULL_TERMINATION | v8::String::REPLACE_INVALID_UTF8));
 			return result;
 		}
 		else
 		{
 			auto const len = str->Length();
-			from_type result(len, 0);
+			from_type result(len, 0, detail::conversion_allocator<Alloc>());
 			result.resize(str->Write(isolate, reinterpret_cast<uint16_t*>(result.data()), 0, len, v8::String::NO_NULL_TERMINATION));
 			return result;
 		}
@@ -135,6 +515,45 @@ struct convert<char const*> : convert<std::basic_string_view<char>>
 {
 };
 
+// converter specialization for interned strings
+template<>
+struct convert<interned_string>
+{
+	using from_type = interned_string;
+	using to_type = v8::Local<v8::String>;
+
+	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
+	{
+		return !value.IsEmpty() && (value->IsString() || value->IsNumber());
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
+		{
+			throw invalid_argument(isolate, value, "String");
+		}
+
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::String> str = value->ToString(context).ToLocalChecked();
+		return interned_string(detail::string_table::instance(isolate).intern(isolate, str));
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, interned_string const& value)
+	{
+		if (value.atom_ && value.atom_->isolate == isolate)
+		{
+			return value.atom_->handle.Get(isolate);
+		}
+		return convert<std::string_view>::to_v8(isolate, value.view());
+	}
+};
+
 template<>
 struct convert<char16_t const*> : convert<std::basic_string_view<char16_t>>
 {
@@ -244,6 +663,11 @@ struct convert<T, typename std::enable_if<std::is_integral<T>::value>::type>
 	}
 
 	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
 	{
 		if (!is_valid(isolate, value))
 		{
@@ -254,16 +678,16 @@ struct convert<T, typename std::enable_if<std::is_integral<T>::value>::type>
 		{
 			if constexpr (std::is_signed_v<T>)
 			{
-				return static_cast<T>(value->Int32Value(isolate->GetCurrentContext()).FromJust());
+				return static_cast<T>(value->Int32Value(context).FromJust());
 			}
 			else
 			{
-				return static_cast<T>(value->Uint32Value(isolate->GetCurrentContext()).FromJust());
+				return static_cast<T>(value->Uint32Value(context).FromJust());
 			}
 		}
 		else
 		{
-			return static_cast<T>(value->IntegerValue(isolate->GetCurrentContext()).FromJust());
+			return static_cast<T>(value->IntegerValue(context).FromJust());
 		}
 	}
 
@@ -308,6 +732,11 @@ struct convert<T, typename std::enable_if<std::is_enum<T>::value>::type>
 		return static_cast<T>(convert<underlying_type>::from_v8(isolate, value));
 	}
 
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+	{
+		return static_cast<T>(convert<underlying_type>::from_v8(isolate, context, value));
+	}
+
 	static to_type to_v8(v8::Isolate* isolate, T value)
 	{
 		return convert<underlying_type>::to_v8(isolate,
@@ -327,13 +756,18 @@ struct convert<T, typename std::enable_if<std::is_floating_point<T>::value>::typ
 	}
 
 	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
 	{
 		if (!is_valid(isolate, value))
 		{
 			throw invalid_argument(isolate, value, "Number");
 		}
 
-		return static_cast<T>(value->NumberValue(isolate->GetCurrentContext()).FromJust());
+		return static_cast<T>(value->NumberValue(context).FromJust());
 	}
 
 	static to_type to_v8(v8::Isolate* isolate, T value)
@@ -356,7 +790,7 @@ struct convert<std::optional<T>>
 
 	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
 	{
-	    if (value.IsEmpty() || value->IsNullOrUndefined())
+		if (value.IsEmpty() || value->IsNullOrUndefined())
 		{
 			return std::nullopt;
 		}
@@ -366,7 +800,23 @@ struct convert<std::optional<T>>
 		}
 		else
 		{
-		    throw invalid_argument(isolate, value, "Optional");
+			throw invalid_argument(isolate, value, "Optional");
+		}
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+	{
+		if (value.IsEmpty() || value->IsNullOrUndefined())
+		{
+			return std::nullopt;
+		}
+		else if (convert<T>::is_valid(isolate, value))
+		{
+			return detail::from_v8_in<convert<T>>(isolate, context, value);
+		}
+		else
+		{
+			throw invalid_argument(isolate, value, "Optional");
 		}
 	}
 
@@ -381,6 +831,18 @@ struct convert<std::optional<T>>
 			return v8::Undefined(isolate);
 		}
 	}
+
+	static to_type to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, std::optional<T> const& value)
+	{
+		if (value)
+		{
+			return detail::to_v8_in<convert<T>>(isolate, context, *value);
+		}
+		else
+		{
+			return v8::Undefined(isolate);
+		}
+	}
 };
 
 // convert std::tuple <-> Array
@@ -399,39 +861,47 @@ struct convert<std::tuple<Ts...>>
 	}
 
 	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
 	{
 		if (!is_valid(isolate, value))
 		{
 			throw invalid_argument(isolate, value, "Tuple");
 		}
-		return from_v8_impl(isolate, value, std::make_index_sequence<N>{});
+		return from_v8_impl(isolate, context, value, std::make_index_sequence<N>{});
 	}
 
 	static to_type to_v8(v8::Isolate* isolate, from_type const& value)
 	{
-		return to_v8_impl(isolate, value, std::make_index_sequence<N>{});
+		return to_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, from_type const& value)
+	{
+		return to_v8_impl(isolate, context, value, std::make_index_sequence<N>{});
 	}
 
 private:
 	template<size_t... Is>
-	static from_type from_v8_impl(v8::Isolate* isolate, v8::Local<v8::Value> value,
+	static from_type from_v8_impl(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value,
 		std::index_sequence<Is...>)
 	{
 		v8::HandleScope scope(isolate);
-		v8::Local<v8::Context> context = isolate->GetCurrentContext();
 		v8::Local<v8::Array> array = value.As<v8::Array>();
 
-		return std::tuple<Ts...>{ v8pp::convert<Ts>::from_v8(isolate, array->Get(context, Is).ToLocalChecked())... };
+		return std::tuple<Ts...>{ detail::from_v8_in<v8pp::convert<Ts>>(isolate, context, array->Get(context, Is).ToLocalChecked())... };
 	}
 
 	template<size_t... Is>
-	static to_type to_v8_impl(v8::Isolate* isolate, std::tuple<Ts...> const& value, std::index_sequence<Is...>)
+	static to_type to_v8_impl(v8::Isolate* isolate, v8::Local<v8::Context> context, std::tuple<Ts...> const& value, std::index_sequence<Is...>)
 	{
 		v8::EscapableHandleScope scope(isolate);
-		v8::Local<v8::Context> context = isolate->GetCurrentContext();
 		v8::Local<v8::Array> result = v8::Array::New(isolate, N);
 
-		(void)std::initializer_list<bool>{ result->Set(context, Is, convert<Ts>::to_v8(isolate, std::get<Is>(value))).FromJust()... };
+		(void)std::initializer_list<bool>{ result->Set(context, Is, detail::to_v8_in<convert<Ts>>(isolate, context, std::get<Is>(value))).FromJust()... };
 
 		return scope.Escape(result);
 	}
@@ -626,24 +1096,29 @@ struct convert<Sequence, typename std::enable_if<detail::is_sequence<Sequence>::
 	using to_type = v8::Local<v8::Array>;
 	using item_type = typename Sequence::value_type;
 
+	// Accepts also any iterable object, its iterator is checked in from_v8()
 	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
 	{
-		return !value.IsEmpty() && value->IsArray();
+		return !value.IsEmpty() && (value->IsArray() || value->IsObject());
 	}
 
 	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
 	{
-		if (!is_valid(isolate, value))
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+	{
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Array> array;
+		if (!detail::iterable_to_array(isolate, context, value).ToLocal(&array))
 		{
 			throw invalid_argument(isolate, value, "Array");
 		}
 
-		v8::HandleScope scope(isolate);
-		v8::Local<v8::Context> context = isolate->GetCurrentContext();
-		v8::Local<v8::Array> array = value.As<v8::Array>();
-
-		from_type result{};
+		from_type result = detail::make_container<from_type>();
 
+		using wrapped_class = typename detail::wrapped_element<item_type>::class_type;
 		constexpr bool is_array = detail::is_array<Sequence>::value;
 		if constexpr (is_array)
 		{
@@ -660,22 +1135,41 @@ struct convert<Sequence, typename std::enable_if<detail::is_sequence<Sequence>::
 			result.reserve(array->Length());
 		}
 
+		if constexpr (!std::is_void_v<wrapped_class>)
+		{
+			// with a single class lookup for all elements
+			if constexpr (is_array)
+			{
+				wrapped_class::unwrap_objects(isolate, context, array, result.begin());
+			}
+			else
+			{
+				wrapped_class::unwrap_objects(isolate, context, array, std::back_inserter(result));
+			}
+			return result;
+		}
+
 		for (uint32_t i = 0, count = array->Length(); i < count; ++i)
 		{
 			v8::Local<v8::Value> item = array->Get(context, i).ToLocalChecked();
 			if constexpr (is_array)
 			{
-				result[i] = convert<item_type>::from_v8(isolate, item);
+				result[i] = detail::from_v8_in<convert<item_type>>(isolate, context, item);
 			}
 			else
 			{
-				result.emplace_back(convert<item_type>::from_v8(isolate, item));
+				result.emplace_back(detail::from_v8_in<convert<item_type>>(isolate, context, item));
 			}
 		}
 		return result;
 	}
 
 	static to_type to_v8(v8::Isolate* isolate, from_type const& value)
+	{
+		return to_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, from_type const& value)
 	{
 		constexpr int max_size = std::numeric_limits<int>::max();
 		if (value.size() > max_size)
@@ -685,13 +1179,19 @@ struct convert<Sequence, typename std::enable_if<detail::is_sequence<Sequence>::
 				+ std::to_string(max_size));
 		}
 
+		using wrapped_class = typename detail::wrapped_element<item_type>::class_type;
+		if constexpr (!std::is_void_v<wrapped_class>)
+		{
+			// with a single class lookup for all elements
+			return wrapped_class::find_objects(isolate, context, value);
+		}
+
 		v8::EscapableHandleScope scope(isolate);
-		v8::Local<v8::Context> context = isolate->GetCurrentContext();
 		v8::Local<v8::Array> result = v8::Array::New(isolate, static_cast<int>(value.size()));
 		uint32_t i = 0;
 		for (item_type const& item : value)
 		{
-			result->Set(context, i++, convert<item_type>::to_v8(isolate, item)).FromJust();
+			result->Set(context, i++, detail::to_v8_in<convert<item_type>>(isolate, context, item)).FromJust();
 		}
 		return scope.Escape(result);
 	}
@@ -714,38 +1214,192 @@ struct convert<Mapping, typename std::enable_if<detail::is_mapping<Mapping>::val
 
 	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
 	{
-		if (!is_valid(isolate, value))
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
 		{
 			throw invalid_argument(isolate, value, "Object");
 		}
 
 		v8::HandleScope scope(isolate);
-		v8::Local<v8::Context> context = isolate->GetCurrentContext();
-		v8::Local<v8::Object> object = value.As<v8::Object>();
-		v8::Local<v8::Array> prop_names = object->GetPropertyNames(context).ToLocalChecked();
 
-		from_type result{};
-		for (uint32_t i = 0, count = prop_names->Length(); i < count; ++i)
+		from_type result = detail::make_container<from_type>();
+		if (value->IsMap())
+		{
+			// key, value pairs in a flat array
+			v8::Local<v8::Array> entries = value.As<v8::Map>()->AsArray();
+			uint32_t const count = entries->Length();
+			if constexpr (detail::has_reserve<Mapping>::value)
+			{
+				result.reserve(count / 2);
+			}
+			for (uint32_t i = 0; i + 1 < count; i += 2)
+			{
+				v8::Local<v8::Value> key = entries->Get(context, i).ToLocalChecked();
+				v8::Local<v8::Value> val = entries->Get(context, i + 1).ToLocalChecked();
+				result.emplace(detail::from_v8_in<convert<Key>>(isolate, context, key),
+					detail::from_v8_in<convert<Value>>(isolate, context, val));
+			}
+			return result;
+		}
+
+		// own enumerable keys without symbols, integer indices as numbers,
+		// without the prototype chain walk
+		v8::Local<v8::Object> object = value.As<v8::Object>();
+		v8::Local<v8::Array> prop_names = object->GetOwnPropertyNames(context,
+			v8::PropertyFilter(v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS), v8::KeyConversionMode::kKeepNumbers).ToLocalChecked();
+		uint32_t const count = prop_names->Length();
+		if constexpr (detail::has_reserve<Mapping>::value)
+		{
+			result.reserve(count);
+		}
+		for (uint32_t i = 0; i < count; ++i)
 		{
 			v8::Local<v8::Value> key = prop_names->Get(context, i).ToLocalChecked();
 			v8::Local<v8::Value> val = object->Get(context, key).ToLocalChecked();
-			const auto k = convert<Key>::from_v8(isolate, key);
-			const auto v = convert<Value>::from_v8(isolate, val);
-			result.emplace(k, v);
+			result.emplace(detail::from_v8_in<convert<Key>>(isolate, context, key),
+					detail::from_v8_in<convert<Value>>(isolate, context, val));
 		}
 		return result;
 	}
 
 	static to_type to_v8(v8::Isolate* isolate, from_type const& value)
+	{
+		return to_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, from_type const& value)
 	{
 		v8::EscapableHandleScope scope(isolate);
-		v8::Local<v8::Context> context = isolate->GetCurrentContext();
-		v8::Local<v8::Object> result = v8::Object::New(isolate);
+
+		std::vector<v8::Local<v8::Name>> names;
+		std::vector<v8::Local<v8::Value>> values;
+		names.reserve(value.size());
+		values.reserve(value.size());
 		for (auto const& item : value)
 		{
-			const auto k = convert<Key>::to_v8(isolate, item.first);
-			const auto v = convert<Value>::to_v8(isolate, item.second);
-			result->Set(context, k, v).FromJust();
+			v8::Local<v8::Value> key = detail::to_v8_in<convert<Key>>(isolate, context, item.first);
+			if (key->IsName())
+			{
+				names.emplace_back(key.template As<v8::Name>());
+			}
+			else
+			{
+				names.emplace_back(key->ToString(context).ToLocalChecked());
+			}
+			values.emplace_back(detail::to_v8_in<convert<Value>>(isolate, context, item.second));
+		}
+
+		// create the object with all properties at once, the last duplicate key wins
+		v8::Local<v8::Value> prototype = detail::object_prototype(isolate, context);
+		v8::Local<v8::Object> result = v8::Object::New(isolate, prototype, names.data(), values.data(), names.size());
+		return scope.Escape(result);
+	}
+};
+
+// convert std::set, std::unordered_set <-> Set
+template<typename Set>
+struct convert<Set, typename std::enable_if<detail::is_set<Set>::value>::type>
+{
+	using from_type = Set;
+	using to_type = v8::Local<v8::Set>;
+	using item_type = typename Set::value_type;
+
+	// Accepts also any iterable object, its iterator is checked in from_v8()
+	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
+	{
+		return !value.IsEmpty() && (value->IsArray() || value->IsObject());
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+	{
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Array> items;
+		if (!detail::iterable_to_array(isolate, context, value).ToLocal(&items))
+		{
+			throw invalid_argument(isolate, value, "Set");
+		}
+
+		from_type result = detail::make_container<from_type>();
+		uint32_t const count = items->Length();
+		if constexpr (detail::has_reserve<Set>::value)
+		{
+			result.reserve(count);
+		}
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			result.insert(detail::from_v8_in<convert<item_type>>(isolate, context, items->Get(context, i).ToLocalChecked()));
+		}
+		return result;
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, from_type const& value)
+	{
+		return to_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, from_type const& value)
+	{
+		v8::EscapableHandleScope scope(isolate);
+		v8::Local<v8::Set> result = v8::Set::New(isolate);
+		for (item_type const& item : value)
+		{
+			result->Add(context, detail::to_v8_in<convert<item_type>>(isolate, context, item)).ToLocalChecked();
+		}
+		return scope.Escape(result);
+	}
+};
+
+// convert js_map <-> Map
+template<typename Mapping>
+struct convert<js_map<Mapping>>
+{
+	using from_type = js_map<Mapping>;
+	using to_type = v8::Local<v8::Map>;
+
+	using Key = typename Mapping::key_type;
+	using Value = typename Mapping::mapped_type;
+
+	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
+	{
+		return !value.IsEmpty() && value->IsMap();
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
+		{
+			throw invalid_argument(isolate, value, "Map");
+		}
+		return { convert<Mapping>::from_v8(isolate, context, value) };
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, from_type const& value)
+	{
+		return to_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, from_type const& value)
+	{
+		v8::EscapableHandleScope scope(isolate);
+		v8::Local<v8::Map> result = v8::Map::New(isolate);
+		for (auto const& item : value.values)
+		{
+			result->Set(context, detail::to_v8_in<convert<Key>>(isolate, context, item.first),
+				detail::to_v8_in<convert<Value>>(isolate, context, item.second)).ToLocalChecked();
 		}
 		return scope.Escape(result);
 	}
@@ -778,10 +1432,12 @@ struct is_wrapped_class : std::conjunction<
 	std::is_class<T>,
 	std::negation<detail::is_string<T>>,
 	std::negation<detail::is_mapping<T>>,
+	std::negation<detail::is_set<T>>,
 	std::negation<detail::is_sequence<T>>,
 	std::negation<detail::is_array<T>>,
 	std::negation<detail::is_tuple<T>>,
 	std::negation<detail::is_shared_ptr<T>>,
+	std::negation<detail::is_unique_ptr<T>>,
 	std::negation<detail::is_optional<T>>>
 {
 };
@@ -802,6 +1458,36 @@ struct is_wrapped_class<std::variant<Ts...>> : std::false_type
 {
 };
 
+template<typename Range>
+struct is_wrapped_class<lazy_range<Range>> : std::false_type
+{
+};
+
+template<typename T, typename Alloc>
+struct is_wrapped_class<lazy_array<T, Alloc>> : std::false_type
+{
+};
+
+template<typename T, typename Alloc>
+struct is_wrapped_class<columnar<T, Alloc>> : std::false_type
+{
+};
+
+template<typename Mapping>
+struct is_wrapped_class<js_map<Mapping>> : std::false_type
+{
+};
+
+template<typename T, typename Traits>
+struct is_wrapped_class<borrowed<T, Traits>> : std::false_type
+{
+};
+
+template<>
+struct is_wrapped_class<interned_string> : std::false_type
+{
+};
+
 template<typename T>
 struct convert<T*, typename std::enable_if<is_wrapped_class<T>::value>::type>
 {
@@ -925,6 +1611,386 @@ struct convert<T, ref_from_shared_ptr>
 	}
 };
 
+// convert specializations for classes wrapped with unique_ptr_traits
+template<typename T>
+struct convert<T*, unique_ptr_traits>
+{
+	using from_type = T*;
+	using to_type = v8::Local<v8::Object>;
+	using class_type = typename std::remove_cv_t<T>;
+
+	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
+	{
+		return !value.IsEmpty() && value->IsObject();
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
+		{
+			return nullptr;
+		}
+		return class_<class_type, unique_ptr_traits>::unwrap_object(isolate, value);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, T const* value)
+	{
+		return class_<class_type, unique_ptr_traits>::find_object(isolate, value);
+	}
+};
+
+template<typename T>
+struct convert<T, unique_ptr_traits>
+{
+	using from_type = T&;
+	using to_type = v8::Local<v8::Object>;
+	using class_type = typename std::remove_cv_t<T>;
+
+	static bool is_valid(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return convert<T*, unique_ptr_traits>::is_valid(isolate, value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
+		{
+			throw invalid_argument(isolate, value, "Object");
+		}
+		T* object = class_<class_type, unique_ptr_traits>::unwrap_object(isolate, value);
+		if (object)
+		{
+			return *object;
+		}
+		throw std::runtime_error("failed to unwrap C++ object");
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, T const& value)
+	{
+		v8::Local<v8::Object> result = class_<class_type, unique_ptr_traits>::find_object(isolate, value);
+		if (!result.IsEmpty()) return result;
+		throw std::runtime_error("failed to wrap C++ object");
+	}
+};
+
+// convert std::unique_ptr <-> Object, moves the C++ object ownership
+// into the JavaScript object, and back from it
+template<typename T>
+struct convert<std::unique_ptr<T>, typename std::enable_if<is_wrapped_class<T>::value>::type>
+{
+	using from_type = std::unique_ptr<T>;
+	using to_type = v8::Local<v8::Object>;
+	using class_type = typename std::remove_cv_t<T>;
+
+	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
+	{
+		return !value.IsEmpty() && value->IsObject();
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
+		{
+			return nullptr;
+		}
+		return from_type(class_<class_type, unique_ptr_traits>::release_object(isolate, value));
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, std::unique_ptr<T> value)
+	{
+		if (!value)
+		{
+			return {};
+		}
+		v8::Local<v8::Object> result = class_<class_type, unique_ptr_traits>::import_external(isolate, value.get());
+		if (!result.IsEmpty())
+		{
+			value.release();
+		}
+		return result;
+	}
+};
+
+// convert lazy_range -> iterator object
+template<typename Range>
+struct convert<lazy_range<Range>>
+{
+	using from_type = lazy_range<Range>;
+	using to_type = v8::Local<v8::Object>;
+
+	static to_type to_v8(v8::Isolate* isolate, lazy_range<Range> value)
+	{
+		using iterator_type = detail::range_iterator<Range>;
+		return iterator_type::wrap(isolate,
+			std::make_unique<iterator_type>(isolate, std::move(value.range), value.chunk_size));
+	}
+};
+
+// convert borrowed -> its wrapper object
+template<typename T, typename Traits>
+struct convert<borrowed<T, Traits>>
+{
+	using from_type = borrowed<T, Traits>;
+	using to_type = v8::Local<v8::Object>;
+
+	static to_type to_v8(v8::Isolate*, borrowed<T, Traits> const& value)
+	{
+		return value.handle();
+	}
+};
+
+// convert lazy_array -> array-like object
+template<typename T, typename Alloc>
+struct convert<lazy_array<T, Alloc>>
+{
+	using from_type = lazy_array<T, Alloc>;
+	using to_type = v8::Local<v8::Object>;
+
+	static to_type to_v8(v8::Isolate* isolate, lazy_array<T, Alloc> value)
+	{
+		using proxy_type = detail::array_proxy<std::vector<T, Alloc>>;
+		return proxy_type::wrap(isolate,
+			std::make_unique<proxy_type>(isolate, std::move(value.values), value.cache));
+	}
+};
+
+namespace detail {
+
+template<typename Array, typename Element, bool (v8::Value::*Is)() const>
+struct typed_array_kind
+{
+	using array_type = Array;
+	using element_type = Element;
+
+	static bool is(v8::Local<v8::Value> value) { return std::invoke(Is, *value); }
+};
+
+// typed array kind for an arithmetic type
+template<typename T>
+auto typed_array_for()
+{
+	static_assert(std::is_arithmetic_v<T>, "T must be arithmetic");
+
+	if constexpr (std::same_as<T, bool>)
+		return typed_array_kind<v8::Uint8Array, uint8_t, &v8::Value::IsUint8Array>{};
+	else if constexpr (std::floating_point<T>)
+	{
+		static_assert(sizeof(T) == sizeof(float) || sizeof(T) == sizeof(double), "unsupported floating point type");
+		if constexpr (sizeof(T) == sizeof(float))
+			return typed_array_kind<v8::Float32Array, float, &v8::Value::IsFloat32Array>{};
+		else
+			return typed_array_kind<v8::Float64Array, double, &v8::Value::IsFloat64Array>{};
+	}
+	else if constexpr (std::is_signed_v<T>)
+	{
+		if constexpr (sizeof(T) == 1)
+			return typed_array_kind<v8::Int8Array, int8_t, &v8::Value::IsInt8Array>{};
+		else if constexpr (sizeof(T) == 2)
+			return typed_array_kind<v8::Int16Array, int16_t, &v8::Value::IsInt16Array>{};
+		else if constexpr (sizeof(T) == 4)
+			return typed_array_kind<v8::Int32Array, int32_t, &v8::Value::IsInt32Array>{};
+		else
+			return typed_array_kind<v8::BigInt64Array, int64_t, &v8::Value::IsBigInt64Array>{};
+	}
+	else
+	{
+		if constexpr (sizeof(T) == 1)
+			return typed_array_kind<v8::Uint8Array, uint8_t, &v8::Value::IsUint8Array>{};
+		else if constexpr (sizeof(T) == 2)
+			return typed_array_kind<v8::Uint16Array, uint16_t, &v8::Value::IsUint16Array>{};
+		else if constexpr (sizeof(T) == 4)
+			return typed_array_kind<v8::Uint32Array, uint32_t, &v8::Value::IsUint32Array>{};
+		else
+			return typed_array_kind<v8::BigUint64Array, uint64_t, &v8::Value::IsBigUint64Array>{};
+	}
+}
+
+template<typename T>
+using typed_array_kind_t = decltype(typed_array_for<T>());
+
+} // namespace detail
+
+// convert columnar <-> Object of typed arrays
+template<typename T, typename Alloc>
+struct convert<columnar<T, Alloc>>
+{
+	using from_type = columnar<T, Alloc>;
+	using to_type = v8::Local<v8::Object>;
+
+	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
+	{
+		return !value.IsEmpty() && value->IsObject() && !value->IsArray();
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return from_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
+		{
+			throw invalid_argument(isolate, value, "Object");
+		}
+
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Object> object = value.As<v8::Object>();
+
+		from_type result;
+		bool sized = false;
+		std::apply([&](auto const&... fields)
+			{
+				(get_column(isolate, context, object, result.rows, sized, fields), ...);
+			}, record<T>::fields);
+		return result;
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, from_type const& value)
+	{
+		return to_v8(isolate, isolate->GetCurrentContext(), value);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, from_type const& value)
+	{
+		v8::EscapableHandleScope scope(isolate);
+		v8::Local<v8::Object> object = v8::Object::New(isolate);
+
+		std::apply([&](auto const&... fields)
+			{
+				(set_column(isolate, context, object, value.rows, fields), ...);
+			}, record<T>::fields);
+		return scope.Escape(object);
+	}
+
+private:
+	template<typename Member>
+	static void get_column(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> object,
+		std::vector<T, Alloc>& rows, bool& sized, record_field<T, Member> const& field)
+	{
+		using kind = detail::typed_array_kind_t<Member>;
+		using element_type = typename kind::element_type;
+
+		v8::Local<v8::Value> column = object->Get(context, v8pp::convert<char const*>::to_v8(isolate, field.name)).ToLocalChecked();
+		if (!kind::is(column))
+		{
+			throw invalid_argument(isolate, column, "TypedArray");
+		}
+
+		v8::Local<v8::TypedArray> array = column.As<v8::TypedArray>();
+		size_t const count = array->Length();
+		if (!sized)
+		{
+			rows.resize(count);
+			sized = true;
+		}
+		else if (count != rows.size())
+		{
+			throw std::invalid_argument(std::string("column ") + field.name + " length mismatch");
+		}
+
+		element_type const* data = reinterpret_cast<element_type const*>(
+			static_cast<char const*>(array->Buffer()->Data()) + array->ByteOffset());
+		for (size_t i = 0; i < count; ++i)
+		{
+			rows[i].*field.member = static_cast<Member>(data[i]);
+		}
+	}
+
+	template<typename Member>
+	static void set_column(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> object,
+		std::vector<T, Alloc> const& rows, record_field<T, Member> const& field)
+	{
+		using kind = detail::typed_array_kind_t<Member>;
+		using element_type = typename kind::element_type;
+
+		size_t const count = rows.size();
+		v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, count * sizeof(element_type));
+		element_type* data = static_cast<element_type*>(buffer->Data());
+		for (size_t i = 0; i < count; ++i)
+		{
+			data[i] = static_cast<element_type>(rows[i].*field.member);
+		}
+
+		v8::Local<v8::Value> array = kind::array_type::New(buffer, 0, count);
+		object->CreateDataProperty(context, v8pp::convert<char const*>::to_v8(isolate, field.name), array).FromJust();
+	}
+};
+
+// convert specializations for classes wrapped with intrusive_ptr_traits,
+// a JavaScript object adds a reference to not yet wrapped C++ object
+template<typename T>
+struct convert<T*, intrusive_ptr_traits>
+{
+	using from_type = T*;
+	using to_type = v8::Local<v8::Object>;
+	using class_type = typename std::remove_cv_t<T>;
+
+	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
+	{
+		return !value.IsEmpty() && value->IsObject();
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
+		{
+			return nullptr;
+		}
+		return class_<class_type, intrusive_ptr_traits>::unwrap_object(isolate, value);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, T const* value)
+	{
+		v8::Local<v8::Object> result = class_<class_type, intrusive_ptr_traits>::find_object(isolate, value);
+		if (result.IsEmpty() && value)
+		{
+			class_type* object = const_cast<class_type*>(value);
+			intrusive_ptr_add_ref(object);
+			result = class_<class_type, intrusive_ptr_traits>::import_external(isolate, object);
+			if (result.IsEmpty())
+			{
+				intrusive_ptr_release(object);
+			}
+		}
+		return result;
+	}
+};
+
+template<typename T>
+struct convert<T, intrusive_ptr_traits>
+{
+	using from_type = T&;
+	using to_type = v8::Local<v8::Object>;
+	using class_type = typename std::remove_cv_t<T>;
+
+	static bool is_valid(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return convert<T*, intrusive_ptr_traits>::is_valid(isolate, value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
+		{
+			throw invalid_argument(isolate, value, "Object");
+		}
+		T* object = class_<class_type, intrusive_ptr_traits>::unwrap_object(isolate, value);
+		if (object)
+		{
+			return *object;
+		}
+		throw std::runtime_error("failed to unwrap C++ object");
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, T const& value)
+	{
+		v8::Local<v8::Object> result = class_<class_type, intrusive_ptr_traits>::find_object(isolate, value);
+		if (!result.IsEmpty()) return result;
+		throw std::runtime_error("failed to wrap C++ object");
+	}
+};
+
 template<typename T>
 struct convert<T&> : convert<T>
 {
@@ -942,6 +2008,15 @@ auto from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
 	return convert<T>::from_v8(isolate, value);
 }
 
+// Context is deduced to not compete with the default value overload below
+template<typename T, typename Context, typename Value>
+	requires std::same_as<Context, v8::Context> && std::derived_from<Value, v8::Value>
+auto from_v8(v8::Isolate* isolate, v8::Local<Context> context, v8::Local<Value> value)
+	-> decltype(convert<T>::from_v8(isolate, value))
+{
+	return detail::from_v8_in<convert<T>>(isolate, context, value);
+}
+
 template<typename T, typename U>
 auto from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value, U const& default_value)
 	-> decltype(convert<T>::from_v8(isolate, value))
@@ -1023,6 +2098,30 @@ auto to_v8(v8::Isolate* isolate, T const& value)
 	return convert<T>::to_v8(isolate, value);
 }
 
+template<typename T>
+auto to_v8(v8::Isolate* isolate, v8::Local<v8::Context> context, T const& value)
+{
+	return detail::to_v8_in<convert<T>>(isolate, context, value);
+}
+
+template<typename T>
+auto to_v8(v8::Isolate* isolate, std::unique_ptr<T>&& value)
+{
+	return convert<std::unique_ptr<T>>::to_v8(isolate, std::move(value));
+}
+
+template<typename Range>
+auto to_v8(v8::Isolate* isolate, lazy_range<Range>&& value)
+{
+	return convert<lazy_range<Range>>::to_v8(isolate, std::move(value));
+}
+
+template<typename T, typename Alloc>
+auto to_v8(v8::Isolate* isolate, lazy_array<T, Alloc>&& value)
+{
+	return convert<lazy_array<T, Alloc>>::to_v8(isolate, std::move(value));
+}
+
 template<typename Iterator>
 v8::Local<v8::Array> to_v8(v8::Isolate* isolate, Iterator begin, Iterator end)
 {
@@ -1042,6 +2141,25 @@ v8::Local<v8::Array> to_v8(v8::Isolate* isolate, std::initializer_list<T> const&
 	return to_v8(isolate, init.begin(), init.end());
 }
 
+namespace detail {
+
+// Convert a value with to_v8() overloads, in the context if its converter uses it
+template<typename T>
+v8::Local<v8::Value> to_v8_value(v8::Isolate* isolate, v8::Local<v8::Context> context, T&& value)
+{
+	using U = std::remove_cvref_t<T>;
+	if constexpr (!std::is_array_v<U> && context_to_v8<convert<U>, T>)
+	{
+		return convert<U>::to_v8(isolate, context, std::forward<T>(value));
+	}
+	else
+	{
+		return to_v8(isolate, std::forward<T>(value));
+	}
+}
+
+} // namespace detail
+
 template<typename T>
 v8::Local<T> to_local(v8::Isolate* isolate, v8::PersistentBase<T> const& handle)
 {
@@ -1056,6 +2174,262 @@ v8::Local<T> to_local(v8::Isolate* isolate, v8::PersistentBase<T> const& handle)
 	}
 }
 
+inline void* detail::isolate_data::find(type_info const& type) const
+{
+	for (entry const& e : entries_)
+	{
+		if (e.type == type) return e.data.get();
+	}
+	return nullptr;
+}
+
+#if defined(V8PP_ISOLATE_DATA_SLOT)
+inline detail::isolate_data* detail::isolate_data::instance(v8::Isolate* isolate, bool create)
+{
+	isolate_data* data = static_cast<isolate_data*>(isolate->GetData(V8PP_ISOLATE_DATA_SLOT));
+	if (!data && create)
+	{
+		data = new isolate_data;
+		isolate->SetData(V8PP_ISOLATE_DATA_SLOT, data);
+	}
+	return data;
+}
+
+inline void detail::isolate_data::remove(v8::Isolate* isolate, type_info const& type)
+{
+	isolate_data* data = instance(isolate, false);
+	if (!data) return;
+
+	auto it = std::find_if(data->entries_.begin(), data->entries_.end(),
+		[&type](entry const& e) { return e.type == type; });
+	if (it == data->entries_.end()) return;
+
+	// destroy outside of the container, the data may access isolate_data
+	data_ptr removed = std::move(it->data);
+	data->entries_.erase(it);
+	if (data->entries_.empty())
+	{
+		isolate->SetData(V8PP_ISOLATE_DATA_SLOT, nullptr);
+		delete data;
+	}
+}
+#else
+namespace detail {
+inline std::mutex& isolate_data_mutex()
+{
+	static std::mutex mutex;
+	return mutex;
+}
+
+inline std::unordered_map<v8::Isolate*, std::unique_ptr<isolate_data>>& isolate_data_instances()
+{
+	static std::unordered_map<v8::Isolate*, std::unique_ptr<isolate_data>> instances;
+	return instances;
+}
+} // namespace detail
+
+inline detail::isolate_data* detail::isolate_data::instance(v8::Isolate* isolate, bool create)
+{
+	std::lock_guard<std::mutex> lock(isolate_data_mutex());
+	auto& instances = isolate_data_instances();
+	auto it = instances.find(isolate);
+	if (it == instances.end())
+	{
+		if (!create) return nullptr;
+		it = instances.emplace(isolate, std::make_unique<isolate_data>()).first;
+	}
+	return it->second.get();
+}
+
+inline void detail::isolate_data::remove(v8::Isolate* isolate, type_info const& type)
+{
+	isolate_data* data = instance(isolate, false);
+	if (!data) return;
+
+	auto it = std::find_if(data->entries_.begin(), data->entries_.end(),
+		[&type](entry const& e) { return e.type == type; });
+	if (it == data->entries_.end()) return;
+
+	// destroy outside of the container, the data may access isolate_data
+	data_ptr removed = std::move(it->data);
+	data->entries_.erase(it);
+	if (data->entries_.empty())
+	{
+		std::lock_guard<std::mutex> lock(isolate_data_mutex());
+		isolate_data_instances().erase(isolate);
+	}
+}
+#endif
+
+inline detail::string_table::~string_table()
+{
+	// interned strings may outlive the table, detach them from the isolate
+	for (auto& [hash, atom] : atoms_)
+	{
+		atom->handle.Reset();
+		atom->isolate = nullptr;
+	}
+}
+
+inline detail::string_table& detail::string_table::instance(v8::Isolate* isolate)
+{
+	return isolate_data::get<string_table>(isolate);
+}
+
+inline void detail::string_table::remove(v8::Isolate* isolate)
+{
+	isolate_data::remove<string_table>(isolate);
+}
+
+inline std::shared_ptr<detail::string_atom const> detail::string_table::intern(v8::Isolate* isolate, v8::Local<v8::String> str)
+{
+	int const hash = str->GetIdentityHash();
+	std::shared_ptr<string_atom> atom = find(isolate, str, hash);
+	return atom ? atom : add(isolate, str, hash);
+}
+
+inline std::shared_ptr<detail::string_atom const> detail::string_table::key(v8::Isolate* isolate, std::string_view name)
+{
+	auto it = keys_.find(name);
+	if (it != keys_.end())
+	{
+		return it->second;
+	}
+
+	v8::HandleScope scope(isolate);
+	v8::Local<v8::String> str = v8::String::NewFromUtf8(isolate, name.data(),
+		v8::NewStringType::kInternalized, static_cast<int>(name.size())).ToLocalChecked();
+	int const hash = str->GetIdentityHash();
+	std::shared_ptr<string_atom> atom = find(isolate, str, hash);
+	if (atom)
+	{
+		// keep the internalized string to skip internalization on property access
+		atom->handle.Reset(isolate, str);
+	}
+	else
+	{
+		atom = add(isolate, str, hash);
+	}
+	// keys are never evicted, they are held in keys_
+	keys_.emplace(atom->value, atom);
+	return atom;
+}
+
+inline std::shared_ptr<detail::string_atom> detail::string_table::find(v8::Isolate* isolate, v8::Local<v8::String> str, int hash) const
+{
+	// equal strings have the same hash, internalized ones are compared by pointer
+	auto const range = atoms_.equal_range(hash);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (it->second->handle.Get(isolate)->StringEquals(str))
+		{
+			return it->second;
+		}
+	}
+	return nullptr;
+}
+
+inline std::shared_ptr<detail::string_atom> detail::string_table::add(v8::Isolate* isolate, v8::Local<v8::String> str, int hash)
+{
+	if (atoms_.size() >= evict_size_)
+	{
+		evict_unused();
+	}
+
+	auto atom = std::make_shared<string_atom>();
+	atom->value = convert<std::string>::from_v8(isolate, str);
+	atom->hash = std::hash<std::string_view>{}(atom->value);
+	atom->isolate = isolate;
+	atom->handle.Reset(isolate, str);
+	atoms_.emplace(hash, atom);
+	return atom;
+}
+
+inline void detail::string_table::evict_unused()
+{
+	std::erase_if(atoms_, [](auto const& item) { return item.second.use_count() == 1; });
+	// amortize eviction over the strings still in use
+	evict_size_ = std::max(evict_size_, atoms_.size() * 2);
+}
+
+inline v8::Local<v8::Value> detail::object_prototype(v8::Isolate* isolate, v8::Local<v8::Context> context)
+{
+	string_table& strings = string_table::instance(isolate);
+	v8::Local<v8::Value> object, prototype;
+	if (context->Global()->Get(context, strings.key(isolate, "Object")->handle.Get(isolate)).ToLocal(&object)
+		&& object->IsObject()
+		&& object.As<v8::Object>()->Get(context, strings.key(isolate, "prototype")->handle.Get(isolate)).ToLocal(&prototype)
+		&& prototype->IsObject())
+	{
+		return prototype;
+	}
+	return v8::Null(isolate);
+}
+
+inline v8::MaybeLocal<v8::Array> detail::iterable_to_array(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
+{
+	if (value.IsEmpty() || !value->IsObject())
+	{
+		return {};
+	}
+	if (value->IsArray())
+	{
+		return value.As<v8::Array>();
+	}
+	if (value->IsSet())
+	{
+		return value.As<v8::Set>()->AsArray();
+	}
+
+	v8::EscapableHandleScope scope(isolate);
+	// iterator protocol calls may throw, report it instead of a pending exception
+	v8::TryCatch try_catch(isolate);
+
+	v8::Local<v8::Value> iterator_function, iterator, next;
+	v8::Local<v8::Array> result;
+	if (value.As<v8::Object>()->Get(context, v8::Symbol::GetIterator(isolate)).ToLocal(&iterator_function)
+		&& iterator_function->IsFunction()
+		&& iterator_function.As<v8::Function>()->Call(context, value, 0, nullptr).ToLocal(&iterator)
+		&& iterator->IsObject()
+		&& iterator.As<v8::Object>()->Get(context, convert<char const*>::to_v8(isolate, "next")).ToLocal(&next)
+		&& next->IsFunction())
+	{
+		v8::Local<v8::String> const done_str = convert<char const*>::to_v8(isolate, "done");
+		v8::Local<v8::String> const value_str = convert<char const*>::to_v8(isolate, "value");
+		result = v8::Array::New(isolate);
+		for (uint32_t index = 0;; ++index)
+		{
+			v8::Local<v8::Value> step, done, item;
+			if (!next.As<v8::Function>()->Call(context, iterator, 0, nullptr).ToLocal(&step) || !step->IsObject()
+				|| !step.As<v8::Object>()->Get(context, done_str).ToLocal(&done))
+			{
+				result.Clear();
+				break;
+			}
+			if (done->BooleanValue(isolate))
+			{
+				break;
+			}
+			if (!step.As<v8::Object>()->Get(context, value_str).ToLocal(&item)
+				|| !result->Set(context, index, item).FromMaybe(false))
+			{
+				result.Clear();
+				break;
+			}
+		}
+	}
+
+	if (try_catch.HasCaught())
+	{
+		throw std::runtime_error(exception_message(isolate, try_catch));
+	}
+	if (result.IsEmpty())
+	{
+		return {};
+	}
+	return scope.Escape(result);
+}
+
 inline invalid_argument::invalid_argument(v8::Isolate* isolate, v8::Local<v8::Value> value, char const* expected_type)
 	: std::invalid_argument(std::string("expected ")
 		+ expected_type
@@ -1065,3 +2439,9 @@ inline invalid_argument::invalid_argument(v8::Isolate* isolate, v8::Local<v8::Va
 }
 
 } // namespace v8pp
+
+template<>
+struct std::hash<v8pp::interned_string>
+{
+	size_t operator()(v8pp::interned_string const& str) const { return str.hash(); }
+};
@@ -2,11 +2,19 @@
 
 #include <cstring> // for memcpy
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <unordered_map>
 
 #include "v8pp/call_from_v8.hpp"
 #include "v8pp/ptr_traits.hpp"
 #include "v8pp/throw_ex.hpp"
+#include "v8pp/type_info.hpp"
 #include "v8pp/utility.hpp"
 
 namespace v8pp::detail {
@@ -133,7 +141,10 @@ private:
 template<typename Traits, typename F, typename FTraits>
 decltype(auto) invoke(v8::FunctionCallbackInfo<v8::Value> const& args)
 {
-	if constexpr (std::is_member_function_pointer<F>())
+	using Fn = call_target_t<F>;
+	decltype(auto) stored = external_data::get<F>(args.Data());
+	Fn& func = call_target<F>::get(stored);
+	if constexpr (std::is_member_function_pointer<Fn>())
 	{
 		using class_type = std::decay_t<typename FTraits::class_type>;
 		auto obj = class_<class_type, Traits>::unwrap_object(args.GetIsolate(), args.This());
@@ -141,11 +152,11 @@ decltype(auto) invoke(v8::FunctionCallbackInfo<v8::Value> const& args)
 		{
 			throw std::runtime_error("method called on null instance");
 		}
-		return (call_from_v8<Traits>(std::forward<F>(external_data::get<F>(args.Data())), args, *obj));
+		return (call_from_v8<Traits>(std::forward<Fn>(func), args, *obj));
 	}
 	else
 	{
-		return (call_from_v8<Traits>(std::forward<F>(external_data::get<F>(args.Data())), args));
+		return (call_from_v8<Traits>(std::forward<Fn>(func), args));
 	}
 }
 
@@ -160,6 +171,11 @@ void forward_function(v8::FunctionCallbackInfo<v8::Value> const& args)
 	v8::HandleScope scope(isolate);
 	try
 	{
+		// std::pmr arguments are allocated in the arena if the function opted in,
+		// alive until the call returns
+		[[maybe_unused]] std::conditional_t<is_call_arena_function<F>::value
+			&& has_pmr_container<typename FTraits::arguments>::value, call_arena, none> arena;
+
 		if constexpr (std::same_as<typename FTraits::return_type, void>)
 		{
 			invoke<Traits, F, FTraits>(args);
@@ -167,7 +183,7 @@ void forward_function(v8::FunctionCallbackInfo<v8::Value> const& args)
 		else
 		{
 			using return_type = typename FTraits::return_type;
-			using converter = typename call_from_v8_traits<F>::template arg_converter<return_type, Traits>;
+			using converter = typename call_from_v8_traits<call_target_t<F>>::template arg_converter<return_type, Traits>;
 			args.GetReturnValue().Set(converter::to_v8(isolate, invoke<Traits, F, FTraits>(args)));
 		}
 	}
@@ -208,4 +224,392 @@ v8::Local<v8::Function> wrap_function(v8::Isolate* isolate, std::string_view nam
 	return fn;
 }
 
+namespace detail {
+
+// Per-isolate cache of function templates for wrap_function_cached and
+// shared bindings, keyed by callable type, traits, function name, and identity
+class function_template_cache
+{
+public:
+	// Cache key, referencing the function name and callable identity bytes
+	struct key
+	{
+		type_info type;
+		type_info traits;
+		std::string_view name;
+		std::string_view identity;
+
+		bool operator==(key const& other) const = default;
+	};
+
+	template<typename F, typename Traits>
+	static key make_key(std::string_view name, void const* identity, size_t identity_size)
+	{
+		return key{ type_id<F>(), type_id<Traits>(), name,
+			std::string_view(static_cast<char const*>(identity), identity_size) };
+	}
+
+	static v8::Local<v8::FunctionTemplate> find(v8::Isolate* isolate, key const& k)
+	{
+		function_template_cache* cache = isolate_data::find<function_template_cache>(isolate);
+		if (!cache) return {};
+		auto it = cache->templates_.find(k);
+		return it != cache->templates_.end() ? it->second.func.Get(isolate) : v8::Local<v8::FunctionTemplate>();
+	}
+
+	static void add(v8::Isolate* isolate, key const& k, v8::Local<v8::FunctionTemplate> func)
+	{
+		// copy the referenced name and identity into the entry
+		entry value{ std::make_unique<char[]>(k.name.size() + k.identity.size()), v8::Global<v8::FunctionTemplate>(isolate, func) };
+		char* const name = value.bytes.get();
+		char* const identity = std::copy(k.name.begin(), k.name.end(), name);
+		std::copy(k.identity.begin(), k.identity.end(), identity);
+
+		key const stored{ k.type, k.traits, std::string_view(name, k.name.size()), std::string_view(identity, k.identity.size()) };
+		isolate_data::get<function_template_cache>(isolate).templates_.emplace(stored, std::move(value));
+	}
+
+	static void remove(v8::Isolate* isolate)
+	{
+		isolate_data::remove<function_template_cache>(isolate);
+	}
+
+private:
+	struct key_hash
+	{
+		size_t operator()(key const& k) const
+		{
+			std::hash<std::string_view> const hash;
+			size_t result = hash(k.type.name());
+			for (std::string_view part : { k.traits.name(), k.name, k.identity })
+			{
+				result ^= hash(part) + 0x9e3779b9 + (result << 6) + (result >> 2);
+			}
+			return result;
+		}
+	};
+
+	struct entry
+	{
+		std::unique_ptr<char[]> bytes; // referenced by the key
+		v8::Global<v8::FunctionTemplate> func;
+	};
+
+	std::unordered_map<key, entry, key_hash> templates_;
+};
+
+// Callable identified by its value: function and member function pointers,
+// lambdas without captures
+template<typename F>
+concept value_identified = std::is_trivially_copyable_v<F>
+	&& (std::is_empty_v<F> || std::has_unique_object_representations_v<F>);
+
+template<typename F, typename Traits>
+function_template_cache::key value_identity_key(std::string_view name, F const& func)
+{
+	return function_template_cache::make_key<F, Traits>(name, &func, std::is_empty_v<F> ? 0 : sizeof(F));
+}
+
+template<typename F, typename Traits>
+v8::Local<v8::FunctionTemplate> cached_function_template(v8::Isolate* isolate, std::string_view name, F&& func,
+	function_template_cache::key const& key)
+{
+	v8::EscapableHandleScope scope(isolate);
+
+	v8::Local<v8::FunctionTemplate> func_template = function_template_cache::find(isolate, key);
+	if (func_template.IsEmpty())
+	{
+		func_template = wrap_function_template<F, Traits>(isolate, std::forward<F>(func));
+		if (!name.empty())
+		{
+			func_template->SetClassName(to_v8(isolate, name));
+		}
+		function_template_cache::add(isolate, key, func_template);
+	}
+	return scope.Escape(func_template);
+}
+
+/// Function template shared by all bindings of a value identified callable
+/// in the isolate if `share` is set, or a new one for other callables.
+/// Shared templates give the same V8 function object in a context.
+template<typename F, typename Traits>
+v8::Local<v8::FunctionTemplate> shared_function_template(v8::Isolate* isolate, F&& func, bool share)
+{
+	using F_type = typename std::decay_t<F>;
+	if constexpr (value_identified<F_type>)
+	{
+		if (share)
+		{
+			F_type const identity = func;
+			return cached_function_template<F, Traits>(isolate, {},
+				std::forward<F>(func), value_identity_key<F_type, Traits>({}, identity));
+		}
+	}
+	return wrap_function_template<F, Traits>(isolate, std::forward<F>(func));
+}
+
+} // namespace detail
+
+/// Wrap C++ function into V8 function, cached by the function identity
+/// Function pointers and trivially copyable callables, like lambdas
+/// without captures, are identified by value. The same function wrapped
+/// again in a context returns the same V8 function.
+template<typename F, typename Traits = raw_ptr_traits>
+	requires detail::value_identified<std::decay_t<F>>
+v8::Local<v8::Function> wrap_function_cached(v8::Isolate* isolate, std::string_view name, F&& func)
+{
+	using F_type = typename std::decay_t<F>;
+	F_type const identity = func;
+	// V8 instantiates a function template once per context
+	return detail::cached_function_template<F, Traits>(isolate, name, std::forward<F>(func),
+		detail::value_identity_key<F_type, Traits>(name, identity))->GetFunction(isolate->GetCurrentContext()).ToLocalChecked();
+}
+
+/// Wrap C++ function into V8 function, cached by the supplied `identity`,
+/// for example an address of a shared callable. The same identity wrapped
+/// again in a context returns the same V8 function, `func` is used once.
+template<typename F, typename Traits = raw_ptr_traits>
+v8::Local<v8::Function> wrap_function_cached(v8::Isolate* isolate, std::string_view name, F&& func, void const* identity)
+{
+	using F_type = typename std::decay_t<F>;
+	return detail::cached_function_template<F, Traits>(isolate, name, std::forward<F>(func),
+		detail::function_template_cache::make_key<F_type, Traits>(name, &identity, sizeof(identity)))->GetFunction(isolate->GetCurrentContext()).ToLocalChecked();
+}
+
+template<typename Signature>
+class js_function;
+
+namespace detail {
+
+class js_function_cache;
+
+// V8 function shared by js_function instances converted from it
+class js_function_state : public std::enable_shared_from_this<js_function_state>
+{
+public:
+	js_function_state(v8::Isolate* isolate, v8::Local<v8::Function> func)
+		: isolate_(isolate)
+		, func_(isolate, func)
+	{
+	}
+
+	v8::Isolate* isolate() const { return isolate_; }
+	v8::Local<v8::Function> function() const { return func_.Get(isolate_); }
+
+private:
+	friend class js_function_cache;
+
+	v8::Isolate* isolate_;
+	v8::Global<v8::Function> func_;
+	js_function_cache* cache_ = nullptr; // cache containing the state, if any
+	int hash_ = 0;
+};
+
+// Per-isolate cache of js_function states, keyed by V8 function identity hash.
+// A state is removed from the cache when the last js_function using it is destroyed.
+class js_function_cache
+{
+public:
+	js_function_cache() = default;
+	js_function_cache(js_function_cache const&) = delete;
+	js_function_cache& operator=(js_function_cache const&) = delete;
+
+	~js_function_cache()
+	{
+		// states may outlive the cache
+		for (auto& [hash, cached] : entries_)
+		{
+			cached.state->cache_ = nullptr;
+		}
+	}
+
+	template<typename Signature>
+	static std::shared_ptr<js_function_state> get(v8::Isolate* isolate, v8::Local<v8::Function> func)
+	{
+		return isolate_data::get<js_function_cache>(isolate).find_or_add(isolate, func, type_id<Signature>());
+	}
+
+	static void remove(v8::Isolate* isolate)
+	{
+		isolate_data::remove<js_function_cache>(isolate);
+	}
+
+private:
+	struct entry
+	{
+		type_info signature;
+		js_function_state* state;
+	};
+
+	std::shared_ptr<js_function_state> find_or_add(v8::Isolate* isolate, v8::Local<v8::Function> func, type_info signature)
+	{
+		int const hash = func->GetIdentityHash();
+		auto range = entries_.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second.signature == signature && it->second.state->function() == func)
+			{
+				return it->second.state->shared_from_this();
+			}
+		}
+
+		std::shared_ptr<js_function_state> state(new js_function_state(isolate, func), &destroy);
+		state->cache_ = this;
+		state->hash_ = hash;
+		entries_.emplace(hash, entry{ signature, state.get() });
+		return state;
+	}
+
+	static void destroy(js_function_state* state)
+	{
+		if (js_function_cache* cache = state->cache_)
+		{
+			auto range = cache->entries_.equal_range(state->hash_);
+			for (auto it = range.first; it != range.second; ++it)
+			{
+				if (it->second.state == state)
+				{
+					cache->entries_.erase(it);
+					break;
+				}
+			}
+		}
+		delete state;
+	}
+
+	std::unordered_multimap<int, entry> entries_;
+};
+
+} // namespace detail
+
+/// C++ callable for a V8 function, converted from V8 with from_v8.
+/// Arguments are converted with to_v8, the result with from_v8<R>.
+/// JavaScript exceptions are rethrown as std::runtime_error.
+/// Instances converted from the same V8 function share their state.
+template<typename R, typename... Args>
+class js_function<R(Args...)>
+{
+public:
+	js_function() = default;
+
+	explicit js_function(std::shared_ptr<detail::js_function_state> state)
+		: state_(std::move(state))
+	{
+	}
+
+	explicit operator bool() const { return state_ != nullptr; }
+
+	v8::Isolate* isolate() const { return state_ ? state_->isolate() : nullptr; }
+	v8::Local<v8::Function> function() const { return state_ ? state_->function() : v8::Local<v8::Function>(); }
+
+	/// Are both converted from the same V8 function
+	friend bool operator==(js_function const& lhs, js_function const& rhs)
+	{
+		return lhs.state_ == rhs.state_;
+	}
+
+	/// Call the function in the current context with undefined `this`
+	R operator()(Args... args) const
+	{
+		if (!state_)
+		{
+			throw std::bad_function_call();
+		}
+
+		v8::Isolate* isolate = state_->isolate();
+		v8::HandleScope scope(isolate);
+		v8::Local<v8::Context> context = isolate->GetCurrentContext();
+		v8::TryCatch try_catch(isolate);
+
+		int const arg_count = sizeof...(Args);
+		// +1 to allocate array for arg_count == 0
+		v8::Local<v8::Value> v8_args[arg_count + 1] =
+		{
+			detail::to_v8_value(isolate, context, std::forward<Args>(args))...
+		};
+
+		v8::Local<v8::Value> result;
+		if (!state_->function()->Call(context, v8::Undefined(isolate), arg_count, v8_args).ToLocal(&result))
+		{
+			if (try_catch.HasTerminated())
+			{
+				try_catch.ReThrow();
+			}
+			throw std::runtime_error(exception_message(isolate, try_catch));
+		}
+		if constexpr (!std::is_void_v<R>)
+		{
+			return v8pp::from_v8<R>(isolate, context, result);
+		}
+	}
+
+private:
+	std::shared_ptr<detail::js_function_state> state_;
+};
+
+template<typename R, typename... Args>
+struct is_wrapped_class<js_function<R(Args...)>> : std::false_type
+{
+};
+
+template<typename R, typename... Args>
+struct is_wrapped_class<std::function<R(Args...)>> : std::false_type
+{
+};
+
+// converter specialization for V8 functions called from C++
+template<typename R, typename... Args>
+struct convert<js_function<R(Args...)>>
+{
+	using from_type = js_function<R(Args...)>;
+	using to_type = v8::Local<v8::Function>;
+
+	static bool is_valid(v8::Isolate*, v8::Local<v8::Value> value)
+	{
+		return !value.IsEmpty() && value->IsFunction();
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		if (!is_valid(isolate, value))
+		{
+			throw invalid_argument(isolate, value, "Function");
+		}
+		return from_type(detail::js_function_cache::get<R(Args...)>(isolate, value.As<v8::Function>()));
+	}
+
+	static to_type to_v8(v8::Isolate*, from_type const& value)
+	{
+		return value.function();
+	}
+};
+
+// converter specialization for std::function, a V8 function converted from V8
+// is held in js_function, a C++ callable is converted to V8 with wrap_function
+template<typename R, typename... Args>
+struct convert<std::function<R(Args...)>>
+{
+	using from_type = std::function<R(Args...)>;
+	using to_type = v8::Local<v8::Function>;
+
+	static bool is_valid(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return convert<js_function<R(Args...)>>::is_valid(isolate, value);
+	}
+
+	static from_type from_v8(v8::Isolate* isolate, v8::Local<v8::Value> value)
+	{
+		return convert<js_function<R(Args...)>>::from_v8(isolate, value);
+	}
+
+	static to_type to_v8(v8::Isolate* isolate, from_type const& value)
+	{
+		if (auto func = value.template target<js_function<R(Args...)>>(); func && func->isolate() == isolate)
+		{
+			return func->function();
+		}
+		return wrap_function(isolate, "", from_type(value));
+	}
+};
+
 } // namespace v8pp
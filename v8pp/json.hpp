@@ -12,16 +12,20 @@ namespace v8pp {
 /// Stringify V8 value to JSON
 /// return empty string for empty value
 std::string json_str(v8::Isolate* isolate, v8::Local<v8::Value> value);
+std::string json_str(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value);
 
 /// Parse JSON string into V8 value
 /// return empty value for empty string
 /// return Error value on parse error
 v8::Local<v8::Value> json_parse(v8::Isolate* isolate, std::string_view str);
+v8::Local<v8::Value> json_parse(v8::Isolate* isolate, v8::Local<v8::Context> context, std::string_view str);
 
 /// Convert wrapped C++ object to JavaScript object with properties
 /// and optionally functions set from the C++ object
 v8::Local<v8::Object> json_object(v8::Isolate* isolate, v8::Local<v8::Object> object,
 	bool with_functions = false);
+v8::Local<v8::Object> json_object(v8::Isolate* isolate, v8::Local<v8::Context> context,
+	v8::Local<v8::Object> object, bool with_functions = false);
 
 } // namespace v8pp
 
@@ -4,6 +4,11 @@
 namespace v8pp {
 
 V8PP_IMPL std::string json_str(v8::Isolate* isolate, v8::Local<v8::Value> value)
+{
+	return json_str(isolate, isolate->GetCurrentContext(), value);
+}
+
+V8PP_IMPL std::string json_str(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Value> value)
 {
 	if (value.IsEmpty())
 	{
@@ -12,12 +17,16 @@ V8PP_IMPL std::string json_str(v8::Isolate* isolate, v8::Local<v8::Value> value)
 
 	v8::HandleScope scope(isolate);
 
-	v8::Local<v8::Context> context = isolate->GetCurrentContext();
 	v8::Local<v8::String> result = v8::JSON::Stringify(context, value).ToLocalChecked();
-	return v8pp::from_v8<std::string>(isolate, result);
+	return v8pp::from_v8<std::string>(isolate, context, result);
 }
 
 V8PP_IMPL v8::Local<v8::Value> json_parse(v8::Isolate* isolate, std::string_view str)
+{
+	return json_parse(isolate, isolate->GetCurrentContext(), str);
+}
+
+V8PP_IMPL v8::Local<v8::Value> json_parse(v8::Isolate* isolate, v8::Local<v8::Context> context, std::string_view str)
 {
 	if (str.empty())
 	{
@@ -26,8 +35,6 @@ V8PP_IMPL v8::Local<v8::Value> json_parse(v8::Isolate* isolate, std::string_view
 
 	v8::EscapableHandleScope scope(isolate);
 
-	v8::Local<v8::Context> context = isolate->GetCurrentContext();
-
 	v8::TryCatch try_catch(isolate);
 	v8::Local<v8::Value> result;
 	bool const is_empty_result = v8::JSON::Parse(context, v8pp::to_v8(isolate, str)).ToLocal(&result);
@@ -40,10 +47,15 @@ V8PP_IMPL v8::Local<v8::Value> json_parse(v8::Isolate* isolate, std::string_view
 }
 
 V8PP_IMPL v8::Local<v8::Object> json_object(v8::Isolate* isolate, v8::Local<v8::Object> object, bool with_functions)
+{
+	return json_object(isolate, isolate->GetCurrentContext(), object, with_functions);
+}
+
+V8PP_IMPL v8::Local<v8::Object> json_object(v8::Isolate* isolate, v8::Local<v8::Context> context,
+	v8::Local<v8::Object> object, bool with_functions)
 {
 	v8::EscapableHandleScope scope(isolate);
 
-	v8::Local<v8::Context> context = isolate->GetCurrentContext();
 	v8::Local<v8::Object> result = v8::Object::New(isolate);
 	v8::Local<v8::Array> prop_names = object->GetPropertyNames(context).ToLocalChecked();
 	for (uint32_t i = 0, count = prop_names->Length(); i < count; ++i)
@@ -40,6 +40,23 @@ public:
 	/// V8 ObjectTemplate implementation
 	v8::Local<v8::ObjectTemplate> impl() const { return obj_; }
 
+	/// Set lazy mode for functions and classes bound after this call:
+	/// a V8 function is created in a context on first access to the module member
+	module& lazy(bool enable = true)
+	{
+		lazy_ = enable;
+		return *this;
+	}
+
+	/// Share function templates of functions bound after this call with other
+	/// modules and classes with the same setting. Such a function bound
+	/// in several places is the same V8 function object in a context.
+	module& share_functions(bool enable = true)
+	{
+		share_functions_ = enable;
+		return *this;
+	}
+
 	/// Set a V8 value in the module with specified name
 	template<typename Data>
 	module& value(std::string_view name, v8::Local<Data> value)
@@ -60,6 +77,12 @@ public:
 	{
 		v8::HandleScope scope(isolate_);
 
+		if (lazy_)
+		{
+			// class templates are created on first access, with the property name
+			obj_->SetLazyDataProperty(v8pp::to_v8(isolate_, name), &lazy_class_get<T, Traits>);
+			return *this;
+		}
 		cl.class_function_template()->SetClassName(v8pp::to_v8(isolate_, name));
 		return value(name, cl.js_function_template());
 	}
@@ -70,7 +93,15 @@ public:
 	{
 		using Fun = typename std::decay_t<Function>;
 		static_assert(detail::is_callable<Fun>::value, "Function must be callable");
-		return value(name, wrap_function_template<Function, Traits>(isolate_, std::forward<Function>(func)));
+		if (lazy_)
+		{
+			v8::HandleScope scope(isolate_);
+
+			obj_->SetLazyDataProperty(v8pp::to_v8(isolate_, name), &lazy_function_get<Fun, Traits>,
+				detail::external_data::set(isolate_, std::forward<Fun>(func)));
+			return *this;
+		}
+		return value(name, detail::shared_function_template<Function, Traits>(isolate_, std::forward<Function>(func), share_functions_));
 	}
 
 	/// Set a C++ variable in the module with specified name
@@ -140,6 +171,44 @@ public:
 	}
 
 private:
+	template<typename Function, typename Traits>
+	static void lazy_function_get(v8::Local<v8::Name>, v8::PropertyCallbackInfo<v8::Value> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+
+		v8::Local<v8::Function> func;
+		if (v8::Function::New(isolate->GetCurrentContext(), &detail::forward_function<Traits, Function>,
+			info.Data()).ToLocal(&func))
+		{
+			info.GetReturnValue().Set(func);
+		}
+	}
+
+	template<typename T, typename Traits>
+	static void lazy_class_get(v8::Local<v8::Name> name, v8::PropertyCallbackInfo<v8::Value> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+
+		try
+		{
+			auto cl = v8pp::class_<T, Traits>::extend(isolate);
+			if (!cl.has_templates() && name->IsString())
+			{
+				// class name can't be changed after the templates have been used
+				cl.class_function_template()->SetClassName(name.As<v8::String>());
+			}
+			v8::Local<v8::Function> func;
+			if (cl.js_function_template()->GetFunction(isolate->GetCurrentContext()).ToLocal(&func))
+			{
+				info.GetReturnValue().Set(func);
+			}
+		}
+		catch (std::exception const& ex)
+		{
+			info.GetReturnValue().Set(throw_ex(isolate, ex.what()));
+		}
+	}
+
 	template<typename Variable>
 	static void var_get(v8::Local<v8::Name>, v8::PropertyCallbackInfo<v8::Value> const& info)
 	{
@@ -160,6 +229,8 @@ private:
 
 	v8::Isolate* isolate_;
 	v8::Local<v8::ObjectTemplate> obj_;
+	bool lazy_ = false;
+	bool share_functions_ = false;
 };
 
 } // namespace v8pp
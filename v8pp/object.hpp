@@ -8,45 +8,76 @@
 
 namespace v8pp {
 
-/// Get optional value from V8 object by name.
+/// Get optional value from V8 object by name in a context.
 /// Dot symbols in option name delimits subobjects name.
 /// return false if the value doesn't exist in the options object
 template<typename T>
-bool get_option(v8::Isolate* isolate, v8::Local<v8::Object> options,
+bool get_option(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> options,
 	std::string_view name, T& value)
 {
 	std::string_view::size_type const dot_pos = name.find('.');
 	if (dot_pos != name.npos)
 	{
 		v8::Local<v8::Object> suboptions;
-		return get_option(isolate, options, name.substr(0, dot_pos), suboptions)
-			&& get_option(isolate, suboptions, name.substr(dot_pos + 1), value);
+		return get_option(isolate, context, options, name.substr(0, dot_pos), suboptions)
+			&& get_option(isolate, context, suboptions, name.substr(dot_pos + 1), value);
 	}
 	v8::Local<v8::Value> val;
-	if (!options->Get(isolate->GetCurrentContext(), v8pp::to_v8(isolate, name)).ToLocal(&val)
+	if (!options->Get(context, v8pp::to_v8(isolate, name)).ToLocal(&val)
 		|| val->IsUndefined())
 	{
 		return false;
 	}
-	value = from_v8<T>(isolate, val);
+	value = from_v8<T>(isolate, context, val);
 	return true;
 }
 
-/// Set named value in V8 object
+/// Get optional value from V8 object by name.
+/// Dot symbols in option name delimits subobjects name.
+/// return false if the value doesn't exist in the options object
+template<typename T>
+bool get_option(v8::Isolate* isolate, v8::Local<v8::Object> options,
+	std::string_view name, T& value)
+{
+	return get_option(isolate, isolate->GetCurrentContext(), options, name, value);
+}
+
+/// Set named value in V8 object in a context
 /// Dot symbols in option name delimits subobjects name.
 /// return false if the value doesn't exists in the options subobject
 template<typename T>
-bool set_option(v8::Isolate* isolate, v8::Local<v8::Object> options,
+bool set_option(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> options,
 	std::string_view name, T const& value)
 {
 	std::string_view::size_type const dot_pos = name.find('.');
 	if (dot_pos != name.npos)
 	{
 		v8::Local<v8::Object> suboptions;
-		return get_option(isolate, options, name.substr(0, dot_pos), suboptions)
-			&& set_option(isolate, suboptions, name.substr(dot_pos + 1), value);
+		return get_option(isolate, context, options, name.substr(0, dot_pos), suboptions)
+			&& set_option(isolate, context, suboptions, name.substr(dot_pos + 1), value);
 	}
-	return options->Set(isolate->GetCurrentContext(), v8pp::to_v8(isolate, name), to_v8(isolate, value)).FromJust();
+	return options->Set(context, v8pp::to_v8(isolate, name), detail::to_v8_value(isolate, context, value)).FromJust();
+}
+
+/// Set named value in V8 object
+/// Dot symbols in option name delimits subobjects name.
+/// return false if the value doesn't exists in the options subobject
+template<typename T>
+bool set_option(v8::Isolate* isolate, v8::Local<v8::Object> options,
+	std::string_view name, T const& value)
+{
+	return set_option(isolate, isolate->GetCurrentContext(), options, name, value);
+}
+
+/// Set named constant in V8 object in a context
+/// Subobject names are not supported
+template<typename T>
+void set_const(v8::Isolate* isolate, v8::Local<v8::Context> context, v8::Local<v8::Object> options,
+	std::string_view name, T const& value)
+{
+	options->DefineOwnProperty(context,
+		v8pp::to_v8(isolate, name), detail::to_v8_value(isolate, context, value),
+		v8::PropertyAttribute(v8::ReadOnly | v8::DontDelete)).FromJust();
 }
 
 /// Set named constant in V8 object
@@ -55,9 +86,7 @@ template<typename T>
 void set_const(v8::Isolate* isolate, v8::Local<v8::Object> options,
 	std::string_view name, T const& value)
 {
-	options->DefineOwnProperty(isolate->GetCurrentContext(),
-		v8pp::to_v8(isolate, name), to_v8(isolate, value),
-		v8::PropertyAttribute(v8::ReadOnly | v8::DontDelete)).FromJust();
+	set_const(isolate, isolate->GetCurrentContext(), options, name, value);
 }
 
 } // namespace v8pp
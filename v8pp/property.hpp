@@ -120,6 +120,10 @@ try
 	else
 	{
 		auto obj = v8pp::class_<GetClass, Traits>::unwrap_object(info.GetIsolate(), info.This());
+		if (!obj)
+		{
+			throw std::runtime_error("property accessed on null instance");
+		}
 		property_get(property.getter, name, info, *obj);
 	}
 }
@@ -144,6 +148,10 @@ try
 	else
 	{
 		auto obj = v8pp::class_<SetClass, Traits>::unwrap_object(info.GetIsolate(), info.This());
+		if (!obj)
+		{
+			throw std::runtime_error("property accessed on null instance");
+		}
 		property_set(property.setter, name, value, info, *obj);
 	}
 }
@@ -156,6 +164,21 @@ catch (std::exception const& ex)
 	// TODO: info.GetReturnValue().Set(false);
 }
 
+#if V8_MAJOR_VERSION > 12 || (V8_MAJOR_VERSION == 12 && V8_MINOR_VERSION >= 4)
+using intercepted_result = v8::Intercepted;
+using indexed_setter_info = v8::PropertyCallbackInfo<void>;
+
+inline v8::Intercepted intercepted(bool yes)
+{
+	return yes ? v8::Intercepted::kYes : v8::Intercepted::kNo;
+}
+#else
+using intercepted_result = void;
+using indexed_setter_info = v8::PropertyCallbackInfo<v8::Value>;
+
+inline void intercepted(bool) {}
+#endif
+
 } // namespace v8pp::detail
 
 namespace v8pp {
@@ -222,4 +245,161 @@ struct property<Get, detail::none, GetClass, detail::none> final
 	}
 };
 
+/// Indexed property of a wrapped class T with get, optional set,
+/// and length functions, converts only accessed elements
+template<typename T, typename Get, typename Set, typename Length>
+struct indexer final
+{
+	Get getter;
+	Set setter;
+	Length length;
+
+	static constexpr bool is_readonly = std::same_as<Set, detail::none>;
+
+	indexer(Get&& getter, Set&& setter, Length&& length)
+		: getter(std::move(getter))
+		, setter(std::move(setter))
+		, length(std::move(length))
+	{
+	}
+
+	template<typename Traits>
+	static detail::intercepted_result get(uint32_t index, v8::PropertyCallbackInfo<v8::Value> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			auto&& self = detail::external_data::get<indexer>(info.Data());
+			auto obj = class_<T, Traits>::unwrap_object(isolate, info.This());
+			if (!obj || index >= std::invoke(self.length, *obj))
+			{
+				return detail::intercepted(false);
+			}
+			info.GetReturnValue().Set(to_v8(isolate, std::invoke(self.getter, *obj, index)));
+		}
+		catch (std::exception const& ex)
+		{
+			info.GetReturnValue().Set(throw_ex(isolate, ex.what()));
+		}
+		return detail::intercepted(true);
+	}
+
+	template<typename Traits>
+	static detail::intercepted_result set(uint32_t index, v8::Local<v8::Value> value,
+		detail::indexed_setter_info const& info)
+	{
+		using value_type = std::remove_cvref_t<std::tuple_element_t<2, typename detail::function_traits<Set>::arguments>>;
+
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			auto&& self = detail::external_data::get<indexer>(info.Data());
+			auto obj = class_<T, Traits>::unwrap_object(isolate, info.This());
+			if (!obj || index >= std::invoke(self.length, *obj))
+			{
+				return detail::intercepted(false);
+			}
+			std::invoke(self.setter, *obj, index, v8pp::from_v8<value_type>(isolate, value));
+		}
+		catch (std::exception const& ex)
+		{
+			if (info.ShouldThrowOnError())
+			{
+				throw_ex(isolate, ex.what());
+			}
+		}
+#if !(V8_MAJOR_VERSION > 12 || (V8_MAJOR_VERSION == 12 && V8_MINOR_VERSION >= 4))
+		info.GetReturnValue().Set(value); // the request has been intercepted
+#endif
+		return detail::intercepted(true);
+	}
+
+	template<typename Traits>
+	static detail::intercepted_result query(uint32_t index, v8::PropertyCallbackInfo<v8::Integer> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			auto&& self = detail::external_data::get<indexer>(info.Data());
+			auto obj = class_<T, Traits>::unwrap_object(isolate, info.This());
+			if (!obj || index >= std::invoke(self.length, *obj))
+			{
+				return detail::intercepted(false);
+			}
+			info.GetReturnValue().Set(static_cast<int32_t>(
+				is_readonly ? v8::ReadOnly | v8::DontDelete : v8::DontDelete));
+		}
+		catch (std::exception const& ex)
+		{
+			throw_ex(isolate, ex.what());
+		}
+		return detail::intercepted(true);
+	}
+
+	template<typename Traits>
+	static detail::intercepted_result remove(uint32_t index, v8::PropertyCallbackInfo<v8::Boolean> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			auto&& self = detail::external_data::get<indexer>(info.Data());
+			auto obj = class_<T, Traits>::unwrap_object(isolate, info.This());
+			if (!obj || index >= std::invoke(self.length, *obj))
+			{
+				return detail::intercepted(false);
+			}
+			// elements can't be deleted
+			info.GetReturnValue().Set(false);
+		}
+		catch (std::exception const& ex)
+		{
+			throw_ex(isolate, ex.what());
+		}
+		return detail::intercepted(true);
+	}
+
+	template<typename Traits>
+	static void enumerate(v8::PropertyCallbackInfo<v8::Array> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			auto&& self = detail::external_data::get<indexer>(info.Data());
+			auto obj = class_<T, Traits>::unwrap_object(isolate, info.This());
+			size_t const count = obj ? static_cast<size_t>(std::invoke(self.length, *obj)) : 0;
+
+			std::vector<v8::Local<v8::Value>> indices;
+			indices.reserve(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				indices.emplace_back(v8::Integer::NewFromUnsigned(isolate, static_cast<uint32_t>(i)));
+			}
+			info.GetReturnValue().Set(v8::Array::New(isolate, indices.data(), indices.size()));
+		}
+		catch (std::exception const& ex)
+		{
+			throw_ex(isolate, ex.what());
+		}
+	}
+
+	template<typename Traits>
+	static void get_length(v8::Local<v8::Name>, v8::PropertyCallbackInfo<v8::Value> const& info)
+	{
+		v8::Isolate* isolate = info.GetIsolate();
+		try
+		{
+			auto&& self = detail::external_data::get<indexer>(info.Data());
+			auto obj = class_<T, Traits>::unwrap_object(isolate, info.This());
+			if (obj)
+			{
+				info.GetReturnValue().Set(static_cast<double>(std::invoke(self.length, *obj)));
+			}
+		}
+		catch (std::exception const& ex)
+		{
+			info.GetReturnValue().Set(throw_ex(isolate, ex.what()));
+		}
+	}
+};
+
 } // namespace v8pp
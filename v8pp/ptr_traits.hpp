@@ -73,10 +73,11 @@ struct shared_ptr_traits
 	using object_id = void*;
 
 	static object_id pointer_id(pointer_type const& ptr) { return ptr.get(); }
-	static pointer_type key(object_id id) { return std::shared_ptr<void>(id, [](void*) {}); }
+	// non-owning key to find objects, without allocation and reference counting
+	static pointer_type key(object_id id) { return pointer_type(pointer_type(), id); }
 	static pointer_type const_pointer_cast(const_pointer_type const& ptr) { return std::const_pointer_cast<void>(ptr); }
 	template<typename T, typename U>
-	static std::shared_ptr<T> static_pointer_cast(std::shared_ptr<U> const& ptr) { return std::static_pointer_cast<T>(ptr); }
+	static std::shared_ptr<T> static_pointer_cast(std::shared_ptr<U> ptr) { return std::static_pointer_cast<T>(std::move(ptr)); }
 
 	template<typename T>
 	using convert_ptr = convert<std::shared_ptr<T>>;
@@ -109,4 +110,112 @@ struct shared_ptr_traits
 	}
 };
 
+/// Objects exclusively owned by a JavaScript object,
+/// could be moved in and out of JavaScript as `std::unique_ptr<T>`
+struct unique_ptr_traits
+{
+	using pointer_type = void*;
+	using const_pointer_type = void const*;
+
+	template<typename T>
+	using object_pointer_type = T*;
+	template<typename T>
+	using object_const_pointer_type = T const*;
+
+	using object_id = void*;
+
+	static object_id pointer_id(void* ptr) { return ptr; }
+	static pointer_type key(object_id id) { return id; }
+	static pointer_type const_pointer_cast(const_pointer_type ptr) { return const_cast<void*>(ptr); }
+	template<typename T, typename U>
+	static T* static_pointer_cast(U* ptr) { return static_cast<T*>(ptr); }
+
+	template<typename T>
+	using convert_ptr = convert<T*, unique_ptr_traits>;
+
+	template<typename T>
+	using convert_ref = convert<T, unique_ptr_traits>;
+
+	template<typename T, typename... Args>
+	static object_pointer_type<T> create(Args&&... args)
+	{
+		return new T(std::forward<Args>(args)...);
+	}
+
+	template<typename T>
+	static object_pointer_type<T> clone(T const& src)
+	{
+		return new T(src);
+	}
+
+	template<typename T>
+	static void destroy(object_pointer_type<T> const& ptr)
+	{
+		std::default_delete<T>{}(ptr);
+	}
+
+	template<typename T>
+	static size_t object_size(object_pointer_type<T> const&)
+	{
+		return sizeof(T);
+	}
+};
+
+/// Objects with embedded reference counter, managed with
+/// `intrusive_ptr_add_ref(T*)` and `intrusive_ptr_release(T*)` functions
+/// found by argument-dependent lookup, as in `boost::intrusive_ptr`.
+/// A JavaScript object holds one reference to the wrapped C++ object.
+struct intrusive_ptr_traits
+{
+	using pointer_type = void*;
+	using const_pointer_type = void const*;
+
+	template<typename T>
+	using object_pointer_type = T*;
+	template<typename T>
+	using object_const_pointer_type = T const*;
+
+	using object_id = void*;
+
+	static object_id pointer_id(void* ptr) { return ptr; }
+	static pointer_type key(object_id id) { return id; }
+	static pointer_type const_pointer_cast(const_pointer_type ptr) { return const_cast<void*>(ptr); }
+	template<typename T, typename U>
+	static T* static_pointer_cast(U* ptr) { return static_cast<T*>(ptr); }
+
+	template<typename T>
+	using convert_ptr = convert<T*, intrusive_ptr_traits>;
+
+	template<typename T>
+	using convert_ref = convert<T, intrusive_ptr_traits>;
+
+	template<typename T, typename... Args>
+	static object_pointer_type<T> create(Args&&... args)
+	{
+		T* ptr = new T(std::forward<Args>(args)...);
+		intrusive_ptr_add_ref(ptr);
+		return ptr;
+	}
+
+	template<typename T>
+	static object_pointer_type<T> clone(T const& src)
+	{
+		T* ptr = new T(src);
+		intrusive_ptr_add_ref(ptr);
+		return ptr;
+	}
+
+	template<typename T>
+	static void destroy(object_pointer_type<T> const& ptr)
+	{
+		intrusive_ptr_release(ptr);
+	}
+
+	template<typename T>
+	static size_t object_size(object_pointer_type<T> const&)
+	{
+		return sizeof(T);
+	}
+};
+
 } //namespace v8pp
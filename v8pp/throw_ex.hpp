@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <string_view>
 
 #include <v8.h>
@@ -29,6 +30,9 @@ v8::Local<v8::Value> throw_syntax_error(v8::Isolate* isolate, std::string_view m
 v8::Local<v8::Value> throw_type_error(v8::Isolate* isolate, std::string_view message,
 	v8::Local<v8::Value> exception_options = {});
 
+/// Message of an exception caught by try_catch, converted to string
+std::string exception_message(v8::Isolate* isolate, v8::TryCatch const& try_catch);
+
 } // namespace v8pp
 
 #if V8PP_HEADER_ONLY
@@ -43,4 +43,16 @@ V8PP_IMPL v8::Local<v8::Value> throw_type_error(v8::Isolate* isolate, std::strin
 	return throw_ex(isolate, message, v8::Exception::TypeError, exception_options);
 }
 
+V8PP_IMPL std::string exception_message(v8::Isolate* isolate, v8::TryCatch const& try_catch)
+{
+	if (try_catch.HasTerminated())
+	{
+		return "execution terminated";
+	}
+
+	v8::HandleScope scope(isolate);
+	v8::String::Utf8Value const message(isolate, try_catch.Exception());
+	return *message ? std::string(*message, message.length()) : std::string();
+}
+
 } // namespace v8pp
@@ -3,6 +3,7 @@
 #include <concepts>
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -103,6 +104,44 @@ struct is_sequence_impl<T, std::void_t<typename T::value_type,
 template<typename T>
 using is_sequence = is_sequence_impl<T>;
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// is_set<T>
+//
+template<typename T, typename U = void>
+struct is_set_impl : std::false_type
+{
+};
+
+template<typename T>
+struct is_set_impl<T, std::void_t<typename T::key_type, typename T::value_type,
+	decltype(std::declval<T>().begin()), decltype(std::declval<T>().end()),
+	decltype(std::declval<T>().insert(std::declval<typename T::value_type>()))>>
+	: std::is_same<typename T::key_type, typename T::value_type>
+{
+};
+
+template<typename T>
+using is_set = is_set_impl<T>;
+
+/////////////////////////////////////////////////////////////////////////////
+//
+// is_pmr_container<T>
+//
+template<typename T, typename U = void>
+struct is_pmr_container_impl : std::false_type
+{
+};
+
+template<typename T>
+struct is_pmr_container_impl<T, std::void_t<typename T::allocator_type, typename T::value_type>>
+	: std::is_same<typename T::allocator_type, std::pmr::polymorphic_allocator<typename T::value_type>>
+{
+};
+
+template<typename T>
+using is_pmr_container = is_pmr_container_impl<T>;
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // has_reserve<T>
@@ -163,6 +202,20 @@ struct is_shared_ptr<std::shared_ptr<T>> : std::true_type
 {
 };
 
+/////////////////////////////////////////////////////////////////////////////
+//
+// is_unique_ptr<T>
+//
+template<typename T>
+struct is_unique_ptr : std::false_type
+{
+};
+
+template<typename T, typename Deleter>
+struct is_unique_ptr<std::unique_ptr<T, Deleter>> : std::true_type
+{
+};
+
 /////////////////////////////////////////////////////////////////////////////
 //
 // is_optional<T>